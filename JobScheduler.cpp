@@ -6,6 +6,8 @@
 #include <iostream>
 #include <vector>
 #include <queue>
+#include <deque>
+#include <cstdint>
 #include <string>
 #include <fstream>
 #include <sstream>
@@ -13,6 +15,16 @@
 #include <algorithm>
 #include <memory>
 #include <limits>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 // ===================== Job Class =====================
 class Job {
@@ -65,6 +77,11 @@ public:
     virtual void setJobs(const std::vector<Job>& jobs) = 0;
     virtual std::string getGanttChart() const = 0;
     virtual std::string getName() const = 0;
+    // Longest stretch the dispatched job may keep the CPU before the policy
+    // has to decide again, assuming nothing else arrives
+    virtual int timeSlice(const Job& job, int) const { return job.remainingTime; }
+    // Whether an arrival can take the CPU away from the running job
+    virtual bool preemptsOnArrival() const { return false; }
     virtual ~Scheduler() {}
 protected:
     std::vector<Job> scheduledJobs;
@@ -114,23 +131,28 @@ public:
 // ===================== SJF Scheduler =====================
 class SJFScheduler : public Scheduler {
     std::vector<Job> sjfQueue;
+    // Shortest remaining time first; ties go to the earlier arrival, then the lower id
+    static bool shorterRemaining(const Job& a, const Job& b) {
+        if (a.remainingTime != b.remainingTime) return a.remainingTime < b.remainingTime;
+        if (a.arrivalTime != b.arrivalTime) return a.arrivalTime < b.arrivalTime;
+        return a.jobId < b.jobId;
+    }
 public:
     SJFScheduler() {}
     std::string getName() const override { return "Shortest Job First (SJF)"; }
     void addJob(const Job& job) override { sjfQueue.push_back(job); }
     Job getNextJob() override {
         if (sjfQueue.empty()) return Job(-1, 0, 0, 0);
-        auto it = std::min_element(sjfQueue.begin(), sjfQueue.end(),
-            [](const Job& a, const Job& b) { return a.remainingTime < b.remainingTime; });
+        auto it = std::min_element(sjfQueue.begin(), sjfQueue.end(), shorterRemaining);
         Job job = *it;
         sjfQueue.erase(it);
         scheduledJobs.push_back(job);
         return job;
     }
     bool hasJobs() const override { return !sjfQueue.empty(); }
+    bool preemptsOnArrival() const override { return true; }
     void schedule(int) override {
-        std::sort(sjfQueue.begin(), sjfQueue.end(),
-            [](const Job& a, const Job& b) { return a.remainingTime < b.remainingTime; });
+        std::sort(sjfQueue.begin(), sjfQueue.end(), shorterRemaining);
     }
     void setJobs(const std::vector<Job>& jobs) override {
         sjfQueue = jobs;
@@ -160,7 +182,7 @@ class RoundRobinScheduler : public Scheduler {
     std::queue<Job> rrQueue;
     int timeQuantum;
 public:
-    RoundRobinScheduler(int quantum = 2) : timeQuantum(quantum) {}
+    RoundRobinScheduler(int quantum = 2) : timeQuantum(std::max(1, quantum)) {}
     std::string getName() const override { return "Round Robin (RR)"; }
     void addJob(const Job& job) override { rrQueue.push(job); }
     Job getNextJob() override {
@@ -171,6 +193,8 @@ public:
         return job;
     }
     bool hasJobs() const override { return !rrQueue.empty(); }
+    // A whole quantum per dispatch; the simulator stops early if the job finishes
+    int timeSlice(const Job&, int) const override { return timeQuantum; }
     void schedule(int) override {}
     void setJobs(const std::vector<Job>& jobs) override {
         std::queue<Job> empty;
@@ -200,40 +224,213 @@ public:
 class PriorityScheduler : public Scheduler {
     std::vector<Job> priorityQueue;
     int agingThreshold, agingIncrement;
+    int lastAgingTime;
+    // Lowest priority value first; ties go to the earlier arrival, then the lower id
+    static bool higherPriority(const Job& a, const Job& b) {
+        if (a.priority != b.priority) return a.priority < b.priority;
+        if (a.arrivalTime != b.arrivalTime) return a.arrivalTime < b.arrivalTime;
+        return a.jobId < b.jobId;
+    }
 public:
     PriorityScheduler(int agingThreshold = 5, int agingIncrement = 1)
-        : agingThreshold(agingThreshold), agingIncrement(agingIncrement) {}
+        : agingThreshold(agingThreshold), agingIncrement(agingIncrement), lastAgingTime(-1) {}
     std::string getName() const override { return "Priority Scheduling with Aging"; }
     void addJob(const Job& job) override { priorityQueue.push_back(job); }
     Job getNextJob() override {
         if (priorityQueue.empty()) return Job(-1, 0, 0, 0);
-        auto it = std::min_element(priorityQueue.begin(), priorityQueue.end(),
-            [](const Job& a, const Job& b) { return a.priority < b.priority; });
+        auto it = std::min_element(priorityQueue.begin(), priorityQueue.end(), higherPriority);
         Job job = *it;
         priorityQueue.erase(it);
         scheduledJobs.push_back(job);
         return job;
     }
     bool hasJobs() const override { return !priorityQueue.empty(); }
+    bool preemptsOnArrival() const override { return true; }
     void schedule(int currentTime) override {
         applyAging(currentTime);
-        std::sort(priorityQueue.begin(), priorityQueue.end(),
-            [](const Job& a, const Job& b) { return a.priority < b.priority; });
+        std::sort(priorityQueue.begin(), priorityQueue.end(), higherPriority);
     }
     void setJobs(const std::vector<Job>& jobs) override {
         priorityQueue = jobs;
-        std::sort(priorityQueue.begin(), priorityQueue.end(),
-            [](const Job& a, const Job& b) { return a.priority < b.priority; });
+        std::sort(priorityQueue.begin(), priorityQueue.end(), higherPriority);
+        lastAgingTime = -1;
         scheduledJobs.clear();
         timelineLog.clear();
     }
+    // Catch up on every time unit since the last call, so aging once per event
+    // gives the same priorities as aging once per tick
     void applyAging(int currentTime) {
         for (auto& job : priorityQueue) {
-            if (currentTime - job.arrivalTime > agingThreshold) {
-                job.priority -= agingIncrement;
+            int agedBefore = std::max(0, lastAgingTime - job.arrivalTime - agingThreshold);
+            int agedNow = std::max(0, currentTime - job.arrivalTime - agingThreshold);
+            if (agedNow > agedBefore) {
+                job.priority -= agingIncrement * (agedNow - agedBefore);
                 if (job.priority < 0) job.priority = 0;
             }
         }
+        lastAgingTime = currentTime;
+    }
+    // Priority the job will have at time `at`, given its value aged up to `now`
+    long long agedPriority(const Job& job, int now, long long at) const {
+        long long start = std::max<long long>(now, (long long)job.arrivalTime + agingThreshold);
+        if (at <= start) return job.priority;
+        return std::max(0LL, job.priority - (long long)agingIncrement * (at - start));
+    }
+    // First time in [from, to] at which the waiting job outranks the running one,
+    // or -1. Both priorities are piecewise linear in time (flat, aging, clamped
+    // at 0), so each piece is solved directly instead of stepping through it.
+    long long overtakeTime(const Job& challenger, const Job& running, int now, long long from, long long to) const {
+        bool winsTies = challenger.arrivalTime != running.arrivalTime
+            ? challenger.arrivalTime < running.arrivalTime
+            : challenger.jobId < running.jobId;
+        long long need = winsTies ? 0 : -1;
+        auto gap = [&](long long at) {
+            return agedPriority(challenger, now, at) - agedPriority(running, now, at);
+        };
+        std::vector<long long> cuts = { from };
+        for (const Job* job : { &challenger, &running }) {
+            long long start = std::max<long long>(now, (long long)job->arrivalTime + agingThreshold);
+            cuts.push_back(start + 1);
+            if (agingIncrement > 0)
+                cuts.push_back(start + std::max(1LL, ((long long)job->priority + agingIncrement - 1) / agingIncrement));
+        }
+        std::sort(cuts.begin(), cuts.end());
+        for (size_t i = 0; i < cuts.size(); ++i) {
+            long long lo = std::max(cuts[i], from);
+            long long hi = std::min(i + 1 < cuts.size() ? cuts[i + 1] - 1 : to, to);
+            if (lo > hi) continue;
+            long long d = gap(lo);
+            if (d <= need) return lo;
+            if (lo == hi) continue;
+            long long step = gap(lo + 1) - d;
+            if (step >= 0) continue;
+            long long at = lo + (d - need + (-step) - 1) / (-step);
+            if (at <= hi) return at;
+        }
+        return -1;
+    }
+    // Keep running until a waiting job ages past the running one
+    int timeSlice(const Job& job, int currentTime) const override {
+        long long end = (long long)currentTime + job.remainingTime;
+        for (const auto& other : priorityQueue) {
+            long long at = overtakeTime(other, job, currentTime, currentTime + 1, end - 1);
+            if (at != -1) end = at;
+        }
+        return (int)(end - currentTime);
+    }
+    std::string getGanttChart() const override {
+        std::ostringstream oss;
+        oss << "Gantt Chart:\nTime:   ";
+        int time = 0;
+        for (const auto& job : scheduledJobs) {
+            oss << std::setw(4) << time << " ";
+            time += job.burstTime;
+        }
+        oss << "\nJobs:   ";
+        for (const auto& job : scheduledJobs) {
+            oss << std::setw(4) << job.name << " ";
+        }
+        return oss.str();
+    }
+};
+
+// ===================== MLFQ Scheduler =====================
+// New jobs enter level 0; using up a level's quantum drops a job one level,
+// and every boostInterval time units all jobs return to level 0. A bitmap of
+// non-empty levels finds the next level with one find-first-set.
+class MLFQScheduler : public Scheduler {
+    struct Entry { Job job; int level; int used; };
+    std::vector<std::deque<Entry>> queues;
+    std::vector<int> quanta;
+    std::uint64_t nonEmpty;
+    int boostInterval, nextBoost;
+    // The job on the CPU, re-filed when the simulator hands it back
+    Entry running;
+    bool isRunning;
+    int dispatchedRemaining;
+    static int lowestSetBit(std::uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(bits);
+#else
+        int index = 0;
+        while (!(bits & 1)) { bits >>= 1; ++index; }
+        return index;
+#endif
+    }
+    void push(const Entry& entry, bool front) {
+        if (front) queues[entry.level].push_front(entry);
+        else queues[entry.level].push_back(entry);
+        nonEmpty |= std::uint64_t(1) << entry.level;
+    }
+    bool isRunningJob(const Job& job) const {
+        return isRunning && job.jobId == running.job.jobId && job.name == running.job.name &&
+               job.arrivalTime == running.job.arrivalTime && job.burstTime == running.job.burstTime;
+    }
+public:
+    // Quanta double per level, starting from baseQuantum
+    MLFQScheduler(int levels = 3, int baseQuantum = 2, int boostInterval = 50)
+        : queues(std::min(std::max(levels, 1), 64)), nonEmpty(0), boostInterval(std::max(0, boostInterval)),
+          nextBoost(this->boostInterval), running{ Job(-1, 0, 0, 0), 0, 0 }, isRunning(false), dispatchedRemaining(0) {
+        for (size_t i = 0; i < queues.size(); ++i)
+            quanta.push_back(i == 0 ? std::max(1, baseQuantum) : quanta.back() * 2);
+    }
+    std::string getName() const override { return "Multilevel Feedback Queue (MLFQ)"; }
+    void addJob(const Job& job) override {
+        if (!isRunningJob(job)) {
+            push({ job, 0, 0 }, false);
+            return;
+        }
+        isRunning = false;
+        Entry entry = running;
+        entry.job = job;
+        entry.used += dispatchedRemaining - job.remainingTime;
+        if (entry.used >= quanta[entry.level]) {
+            // Quantum used up: demote, behind the level's other jobs
+            entry.level = std::min(entry.level + 1, (int)queues.size() - 1);
+            entry.used = 0;
+            push(entry, false);
+        } else {
+            // Cut short by an arrival or a boost: resume first in its level
+            push(entry, true);
+        }
+    }
+    Job getNextJob() override {
+        if (nonEmpty == 0) return Job(-1, 0, 0, 0);
+        int level = lowestSetBit(nonEmpty);
+        running = queues[level].front();
+        queues[level].pop_front();
+        if (queues[level].empty()) nonEmpty &= ~(std::uint64_t(1) << level);
+        isRunning = true;
+        dispatchedRemaining = running.job.remainingTime;
+        scheduledJobs.push_back(running.job);
+        return running.job;
+    }
+    bool hasJobs() const override { return nonEmpty != 0; }
+    bool preemptsOnArrival() const override { return true; }
+    int timeSlice(const Job&, int currentTime) const override {
+        int slice = quanta[running.level] - running.used;
+        if (boostInterval > 0) slice = std::min(slice, nextBoost - currentTime);
+        return std::max(1, slice);
+    }
+    void schedule(int currentTime) override {
+        if (boostInterval == 0 || currentTime < nextBoost) return;
+        // Lower levels move up in level order, so each keeps its FIFO order
+        for (auto& entry : queues[0]) entry.used = 0;
+        for (size_t level = 1; level < queues.size(); ++level) {
+            for (auto& entry : queues[level]) queues[0].push_back({ entry.job, 0, 0 });
+            queues[level].clear();
+        }
+        nonEmpty = queues[0].empty() ? 0 : 1;
+        nextBoost = (currentTime / boostInterval + 1) * boostInterval;
+    }
+    void setJobs(const std::vector<Job>& jobs) override {
+        for (auto& queue : queues) queue.clear();
+        nonEmpty = 0;
+        isRunning = false;
+        nextBoost = boostInterval;
+        for (const auto& job : jobs) push({ job, 0, 0 }, false);
+        scheduledJobs.clear();
+        timelineLog.clear();
     }
     std::string getGanttChart() const override {
         std::ostringstream oss;
@@ -255,44 +452,72 @@ public:
 class Simulator {
     int currentTime;
     std::unique_ptr<Scheduler> scheduler;
-    std::vector<Job> allJobs;
+    std::vector<Job> allJobs;     // sorted by arrival; admission advances nextArrival
+    size_t nextArrival;
     std::vector<Job> finishedJobs;
-    std::vector<std::pair<int, int>> ganttChart; // (jobId, time)
+    // Run-length segments, appended only when the running job changes
+    struct GanttSegment { int jobId; int start; int length; };
+    std::vector<GanttSegment> ganttChart;
 public:
     Simulator(std::unique_ptr<Scheduler> sched, std::vector<Job> jobs)
-        : currentTime(0), scheduler(std::move(sched)), allJobs(std::move(jobs)) {}
+        : currentTime(0), scheduler(std::move(sched)), allJobs(std::move(jobs)), nextArrival(0) {
+        // Stable so jobs arriving together keep their input order
+        std::stable_sort(allJobs.begin(), allJobs.end(),
+            [](const Job& a, const Job& b) { return a.arrivalTime < b.arrivalTime; });
+    }
 
+    // Event-driven: each dispatch runs the job up to the next point where the
+    // outcome could change (completion, end of the scheduler's slice, or an
+    // arrival under a preemptive policy), rather than one time unit at a time.
     void run() {
-        while (!allJobs.empty() || scheduler->hasJobs()) {
-            for (auto it = allJobs.begin(); it != allJobs.end();) {
-                if (it->arrivalTime <= currentTime) {
-                    scheduler->addJob(*it);
-                    it = allJobs.erase(it);
-                } else {
-                    ++it;
-                }
+        while (nextArrival < allJobs.size() || scheduler->hasJobs()) {
+            admitArrivals(currentTime);
+            if (!scheduler->hasJobs()) {
+                currentTime = nextArrivalTime();
+                continue;
             }
             scheduler->schedule(currentTime);
 
-            if (scheduler->hasJobs()) {
-                Job job = scheduler->getNextJob();
-                if (job.startTime == -1) job.startTime = currentTime;
-                ganttChart.push_back({job.jobId, currentTime});
-                job.remainingTime--;
-                currentTime++;
-                if (job.remainingTime == 0) {
-                    job.completionTime = currentTime;
-                    job.calculateMetrics();
-                    finishedJobs.push_back(job);
-                } else {
-                    scheduler->addJob(job);
-                }
+            Job job = scheduler->getNextJob();
+            if (job.startTime == -1) job.startTime = currentTime;
+            int sliceEnd = currentTime + std::max(0, job.remainingTime);
+            if (job.remainingTime > 0) {
+                int slice = std::max(1, std::min(scheduler->timeSlice(job, currentTime), job.remainingTime));
+                sliceEnd = currentTime + slice;
+                if (scheduler->preemptsOnArrival() && nextArrival < allJobs.size())
+                    sliceEnd = std::min(sliceEnd, nextArrivalTime());
+            }
+            if (sliceEnd > currentTime) {
+                if (!ganttChart.empty() && ganttChart.back().jobId == job.jobId &&
+                    ganttChart.back().start + ganttChart.back().length == currentTime)
+                    ganttChart.back().length += sliceEnd - currentTime;
+                else
+                    ganttChart.push_back({job.jobId, currentTime, sliceEnd - currentTime});
+            }
+            job.remainingTime -= sliceEnd - currentTime;
+            // Jobs that arrived while this one was running queue up ahead of it
+            admitArrivals(sliceEnd - 1);
+            currentTime = sliceEnd;
+            if (job.remainingTime <= 0) {
+                job.completionTime = currentTime;
+                job.calculateMetrics();
+                finishedJobs.push_back(job);
             } else {
-                currentTime++;
+                scheduler->addJob(job);
             }
         }
     }
 
+    void admitArrivals(int upTo) {
+        while (nextArrival < allJobs.size() && allJobs[nextArrival].arrivalTime <= upTo) {
+            scheduler->addJob(allJobs[nextArrival++]);
+        }
+    }
+
+    int nextArrivalTime() const {
+        return allJobs[nextArrival].arrivalTime;
+    }
+
     void reportMetrics() const {
         double totalTurnaround = 0, totalWaiting = 0;
         for (const auto& job : finishedJobs) {
@@ -308,48 +533,125 @@ public:
 
     void printGanttChart() const {
         std::cout << "\nGantt Chart:\n";
-        for (const auto& entry : ganttChart) {
-            std::cout << "JobID: " << entry.first << " at Time: " << entry.second << std::endl;
+        for (const auto& segment : ganttChart) {
+            std::cout << "JobID: " << segment.jobId << " from Time: " << segment.start
+                      << " to " << segment.start + segment.length << std::endl;
         }
     }
 };
 
 // ===================== Job Loader =====================
+// Parses `id,arrival,burst,priority` or `name,arrival,burst,priority` rows
+// in place with std::from_chars. An optional `id,`/`name,` header is skipped;
+// malformed rows are reported on stderr and skipped.
+class CsvRowParser {
+    std::vector<Job>& jobs;
+    size_t lineNo = 0;
+    bool seenFirstRow = false;
+    int nextId = 1;
+    size_t errors = 0;
+
+    static std::string_view trim(std::string_view s) {
+        while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) s.remove_prefix(1);
+        while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '\r')) s.remove_suffix(1);
+        return s;
+    }
+    static bool parseInt(std::string_view field, int& value) {
+        const char* end = field.data() + field.size();
+        auto [ptr, ec] = std::from_chars(field.data(), end, value);
+        return ec == std::errc() && ptr == end && !field.empty();
+    }
+    void rowError(const std::string& message) {
+        if (++errors <= 100) std::cerr << "Line " << lineNo << ": " << message << std::endl;
+    }
+    void row(std::string_view line) {
+        ++lineNo;
+        if (trim(line).empty()) return;
+        std::string_view fields[4];
+        size_t count = 0;
+        while (true) {
+            size_t comma = line.find(',');
+            if (count < 4) fields[count] = trim(line.substr(0, comma));
+            ++count;
+            if (comma == std::string_view::npos) break;
+            line.remove_prefix(comma + 1);
+        }
+        if (!seenFirstRow) {
+            seenFirstRow = true;
+            if (fields[0] == "id" || fields[0] == "name") return;
+        }
+        if (count != 4) { rowError("expected 4 fields, found " + std::to_string(count)); return; }
+        int id, arrival, burst, priority;
+        bool named = !parseInt(fields[0], id);
+        if (named && fields[0].empty()) { rowError("empty job name"); return; }
+        if (!parseInt(fields[1], arrival)) { rowError("invalid arrival time '" + std::string(fields[1]) + "'"); return; }
+        if (!parseInt(fields[2], burst)) { rowError("invalid burst time '" + std::string(fields[2]) + "'"); return; }
+        if (!parseInt(fields[3], priority)) { rowError("invalid priority '" + std::string(fields[3]) + "'"); return; }
+        if (burst < 0) { rowError("negative burst time"); return; }
+        if (named) {
+            jobs.emplace_back(std::string(fields[0]), arrival, burst, priority);
+            jobs.back().jobId = nextId++;
+        } else {
+            jobs.emplace_back(id, arrival, burst, priority);
+        }
+    }
+public:
+    explicit CsvRowParser(std::vector<Job>& jobs) : jobs(jobs) {}
+    ~CsvRowParser() {
+        if (errors > 100) std::cerr << (errors - 100) << " more rows skipped." << std::endl;
+    }
+    // Parses complete lines (and the trailing partial one when `last`);
+    // returns where the unparsed tail starts
+    const char* feed(const char* begin, const char* end, bool last) {
+        const char* p = begin;
+        while (p < end) {
+            const char* nl = (const char*)std::memchr(p, '\n', end - p);
+            if (!nl && !last) break;
+            row(std::string_view(p, (nl ? nl : end) - p));
+            p = nl ? nl + 1 : end;
+        }
+        return p;
+    }
+};
+
+// Memory-maps the file where possible, otherwise reads it in large blocks
 std::vector<Job> loadJobsFromCSV(const std::string& filename) {
     std::vector<Job> jobs;
-    std::ifstream file(filename);
-    if (!file.is_open()) {
+    CsvRowParser parser(jobs);
+#if defined(__unix__) || defined(__APPLE__)
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd >= 0 && ::fstat(fd, &st) == 0 && st.st_size > 0) {
+        size_t size = (size_t)st.st_size;
+        void* map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+            const char* data = (const char*)map;
+            jobs.reserve(std::count(data, data + size, '\n') + 1);
+            parser.feed(data, data + size, true);
+            ::munmap(map, size);
+            ::close(fd);
+            return jobs;
+        }
+    }
+    if (fd >= 0) ::close(fd);
+#endif
+    std::FILE* file = std::fopen(filename.c_str(), "rb");
+    if (!file) {
         std::cerr << "Error: Could not open file " << filename << std::endl;
         return jobs;
     }
-
-    std::string line;
-    std::getline(file, line); // Skip header
-    int id = 1;
-
-    while (std::getline(file, line)) {
-        std::stringstream ss(line);
-        int arrival, burst, priority;
-        char comma;
-
-        // Try to parse as: id,arrival,burst,priority
-        int fileId;
-        if (ss >> fileId >> comma >> arrival >> comma >> burst >> comma >> priority) {
-            jobs.emplace_back(fileId, arrival, burst, priority);
-        } else {
-            // Try to parse as: name,arrival,burst,priority
-            ss.clear();
-            ss.str(line);
-            std::string name;
-            if (std::getline(ss, name, ',') &&
-                ss >> arrival >> comma &&
-                ss >> burst >> comma &&
-                ss >> priority) {
-                jobs.emplace_back(name, arrival, burst, priority);
-                jobs.back().jobId = id++;
-            }
-        }
-    }
+    std::vector<char> buffer(4 << 20);
+    size_t carried = 0;
+    while (true) {
+        if (carried == buffer.size()) buffer.resize(buffer.size() * 2);
+        size_t got = std::fread(buffer.data() + carried, 1, buffer.size() - carried, file);
+        const char* end = buffer.data() + carried + got;
+        const char* rest = parser.feed(buffer.data(), end, got == 0);
+        carried = end - rest;
+        std::memmove(buffer.data(), rest, carried);
+        if (got == 0) break;
+    }
+    std::fclose(file);
     return jobs;
 }
 
@@ -462,14 +764,16 @@ public:
             case 1: std::cout << "SJF\n"; break;
             case 2: std::cout << "Round Robin\n"; break;
             case 3: std::cout << "Priority\n"; break;
+            case 4: std::cout << "MLFQ\n"; break;
         }
         std::cout << "\n1. FCFS (First Come First Serve)\n";
         std::cout << "2. SJF (Shortest Job First)\n";
         std::cout << "3. Round Robin\n";
         std::cout << "4. Priority (with aging)\n";
-        std::cout << "5. Back\n";
-        int choice = getIntInput("Select an option: ", 1, 5);
-        if (choice >= 1 && choice <= 4) {
+        std::cout << "5. MLFQ (Multilevel Feedback Queue)\n";
+        std::cout << "6. Back\n";
+        int choice = getIntInput("Select an option: ", 1, 6);
+        if (choice >= 1 && choice <= 5) {
             currentAlgorithm = choice - 1;
             std::cout << "Algorithm changed.\n";
             pause();
@@ -548,6 +852,7 @@ public:
             case 1: return "SJF (Shortest Job First)";
             case 2: return "Round Robin";
             case 3: return "Priority Scheduling with Aging";
+            case 4: return "Multilevel Feedback Queue (MLFQ)";
             default: return "Unknown";
         }
     }
@@ -559,9 +864,11 @@ public:
             case 1: sched = std::make_unique<SJFScheduler>(); break;
             case 2: sched = std::make_unique<RoundRobinScheduler>(rrQuantum); break;
             case 3: sched = std::make_unique<PriorityScheduler>(agingThreshold, agingIncrement); break;
+            case 4: sched = std::make_unique<MLFQScheduler>(3, rrQuantum); break;
             default: sched = std::make_unique<FCFSScheduler>();
         }
-        sched->setJobs(jobs);
+        // The simulator admits jobs as they arrive; pre-seeding the queue with
+        // setJobs() would hand every job to the scheduler twice
         return std::make_unique<Simulator>(std::move(sched), jobs);
     }
 
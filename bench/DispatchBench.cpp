@@ -0,0 +1,228 @@
+// DispatchBench.cpp
+// Contention benchmark: Chase-Lev work-stealing deques against one
+// mutex-guarded std::queue, plus a replay of a job CSV on real threads set
+// against the simulated schedule of the same workload.
+// Compile: g++ -std=c++17 -O2 -pthread -Iinclude bench/DispatchBench.cpp src/WorkStealingScheduler.cpp src/WorkStealingExecutor.cpp src/MultiCoreSimulator.cpp src/FCFSScheduler.cpp src/ArrivalSource.cpp src/CsvLoader.cpp src/Statistics.cpp src/GanttChart.cpp src/GanttRenderer.cpp src/OutputBuffer.cpp src/EventLog.cpp src/JobTable.cpp src/Job.cpp -o dispatch_bench
+// Run: ./dispatch_bench [--tasks N] [--threads 1,2,4,8] [--work ITERATIONS]
+//      ./dispatch_bench --replay jobs.csv [--threads N] [--tick-us MICROSECONDS]
+
+#include "../include/WorkStealingScheduler.h"
+#include "../include/WorkStealingExecutor.h"
+#include "../include/MultiCoreSimulator.h"
+#include "../include/FCFSScheduler.h"
+#include "../include/CsvLoader.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// What FCFSScheduler's queue would look like shared between threads
+class MutexQueue {
+public:
+    void push(JobHandle job) {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push(job);
+    }
+    JobHandle take() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (jobs.empty()) return kNoJob;
+        JobHandle job = jobs.front();
+        jobs.pop();
+        return job;
+    }
+
+private:
+    std::mutex mutex;
+    std::queue<JobHandle> jobs;
+};
+
+// Stand-in for the work a dispatched task does
+void spin(unsigned iterations) {
+    volatile unsigned sink = 0;
+    for (unsigned i = 0; i < iterations; ++i) sink = sink + i;
+}
+
+// Runs `body(worker)` on every thread and returns the wall time in ms
+template <typename Body>
+double timeThreads(unsigned threads, Body body) {
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned w = 0; w < threads; ++w) workers.emplace_back(body, w);
+    for (auto& worker : workers) worker.join();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+// Every task is queued up front by one producer, then the workers drain it
+double bulkMutex(unsigned threads, std::size_t tasks, unsigned work) {
+    MutexQueue queue;
+    for (std::size_t i = 0; i < tasks; ++i) queue.push((JobHandle)i);
+    return timeThreads(threads, [&](unsigned) {
+        while (queue.take() != kNoJob) spin(work);
+    });
+}
+
+double bulkStealing(unsigned threads, std::size_t tasks, unsigned work) {
+    WorkStealingScheduler queue(threads);
+    for (std::size_t i = 0; i < tasks; ++i) queue.push(0, (JobHandle)i);
+    std::atomic<std::size_t> done(0);
+    return timeThreads(threads, [&](unsigned worker) {
+        while (done.load(std::memory_order_relaxed) < tasks) {
+            if (queue.take(worker) == kNoJob) continue;
+            spin(work);
+            done.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+}
+
+// Fork-join: each task spawns two children until the tree is `depth` deep,
+// so new work appears on whichever thread ran the parent
+std::size_t treeSize(unsigned depth) { return ((std::size_t)1 << (depth + 1)) - 1; }
+
+double treeMutex(unsigned threads, unsigned depth, unsigned work) {
+    // Handle = depth left; children are queued under the same lock
+    MutexQueue queue;
+    queue.push(depth);
+    std::atomic<std::size_t> done(0);
+    std::size_t total = treeSize(depth);
+    return timeThreads(threads, [&](unsigned) {
+        while (done.load(std::memory_order_relaxed) < total) {
+            JobHandle left = queue.take();
+            if (left == kNoJob) continue;
+            spin(work);
+            if (left > 0) {
+                queue.push(left - 1);
+                queue.push(left - 1);
+            }
+            done.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+}
+
+double treeStealing(unsigned threads, unsigned depth, unsigned work) {
+    WorkStealingScheduler queue(threads);
+    queue.push(0, depth);
+    std::atomic<std::size_t> done(0);
+    std::size_t total = treeSize(depth);
+    return timeThreads(threads, [&](unsigned worker) {
+        while (done.load(std::memory_order_relaxed) < total) {
+            JobHandle left = queue.take(worker);
+            if (left == kNoJob) continue;
+            spin(work);
+            if (left > 0) {
+                queue.push(worker, left - 1);
+                queue.push(worker, left - 1);
+            }
+            done.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+}
+
+std::vector<unsigned> parseList(const std::string& text) {
+    std::vector<unsigned> values;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ','))
+        if (!item.empty()) values.push_back((unsigned)std::strtoul(item.c_str(), nullptr, 10));
+    return values;
+}
+
+void contention(std::size_t tasks, const std::vector<unsigned>& threadCounts, unsigned work) {
+    unsigned depth = 0;
+    while (treeSize(depth + 1) <= tasks) ++depth;
+    std::cout << "Bulk: " << tasks << " tasks queued up front; fork-join: " << treeSize(depth)
+              << " tasks in a depth-" << depth << " tree; " << work << " spin iterations per task\n";
+    std::cout << std::left << std::setw(9) << "Threads" << std::right
+              << std::setw(16) << "bulk mutex" << std::setw(16) << "bulk stealing"
+              << std::setw(16) << "tree mutex" << std::setw(16) << "tree stealing" << "   (ns per task)\n";
+    std::cout << std::fixed << std::setprecision(1);
+    for (unsigned threads : threadCounts) {
+        if (threads == 0) continue;
+        double perTask = 1e6 / tasks, perNode = 1e6 / treeSize(depth);
+        std::cout << std::left << std::setw(9) << threads << std::right
+                  << std::setw(16) << bulkMutex(threads, tasks, work) * perTask
+                  << std::setw(16) << bulkStealing(threads, tasks, work) * perTask
+                  << std::setw(16) << treeMutex(threads, depth, work) * perNode
+                  << std::setw(16) << treeStealing(threads, depth, work) * perNode << "\n";
+    }
+}
+
+void row(const char* label, const Distribution& simulated, const Distribution& measured) {
+    std::cout << std::left << std::setw(12) << label << std::right
+              << std::setw(12) << simulated.mean << std::setw(10) << simulated.p99
+              << std::setw(12) << measured.mean << std::setw(10) << measured.p99 << "\n";
+}
+
+int replay(const std::string& path, unsigned threads, long long tickUs) {
+    std::vector<Job> jobs;
+    CsvLoadResult rows = CsvJobLoader::load(path, jobs);
+    if (!rows.opened) {
+        std::cerr << "Error: cannot open " << path << "\n";
+        return 1;
+    }
+    if (rows.errorCount > 0) std::cerr << "Skipped " << rows.errorCount << " malformed rows\n";
+    auto set = SharedJobSet::create(jobs);
+
+    MultiCoreConfig config;
+    config.cores = (int)threads;
+    config.mode = CoreQueueMode::Global;
+    MultiCoreSimulator simulated([] { return std::make_unique<FCFSScheduler>(); },
+                                 std::make_unique<SharedArrivalSource>(set), config);
+    simulated.run();
+    RunStatistics sim = simulated.statistics();
+
+    WorkStealingExecutor executor(threads, std::chrono::microseconds(tickUs));
+    ReplayResult real = executor.replay(set);
+    RunStatistics measured = StatisticsEngine::compute(real.jobs);
+
+    std::cout << jobs.size() << " jobs on " << threads << " threads, 1 time unit = " << tickUs << " us\n";
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << std::left << std::setw(12) << "" << std::right << std::setw(22) << "simulated (FCFS)"
+              << std::setw(22) << "measured (stealing)" << "\n";
+    std::cout << std::left << std::setw(12) << "Metric" << std::right << std::setw(12) << "mean" << std::setw(10) << "p99"
+              << std::setw(12) << "mean" << std::setw(10) << "p99" << "\n";
+    row("Waiting", sim.waiting, measured.waiting);
+    row("Turnaround", sim.turnaround, measured.turnaround);
+    row("Response", sim.response, measured.response);
+    std::cout << "Makespan: " << sim.makespan << " simulated, " << measured.makespan << " measured\n";
+    std::cout << "Release to dispatch (ns): mean " << real.dispatchNs.mean << ", p50 " << real.dispatchNs.p50
+              << ", p99 " << real.dispatchNs.p99 << ", max " << real.dispatchNs.max << "\n";
+    std::cout << "Steals: " << real.steals << ", wall time " << real.wallMs << " ms\n";
+    return 0;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    std::size_t tasks = 1000000;
+    std::vector<unsigned> threadCounts = { 1, 2, 4, 8 };
+    unsigned work = 50;
+    std::string replayPath;
+    long long tickUs = 100;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--tasks" && hasValue) tasks = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--threads" && hasValue) threadCounts = parseList(argv[++i]);
+        else if (arg == "--work" && hasValue) work = (unsigned)std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "--replay" && hasValue) replayPath = argv[++i];
+        else if (arg == "--tick-us" && hasValue) tickUs = std::max(1LL, std::atoll(argv[++i]));
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--tasks N] [--threads 1,2,4,8] [--work ITERATIONS]\n"
+                      << "       " << argv[0] << " --replay jobs.csv [--threads N] [--tick-us MICROSECONDS]\n";
+            return 2;
+        }
+    }
+    if (!replayPath.empty())
+        return replay(replayPath, threadCounts.empty() || threadCounts[0] == 0 ? 1 : threadCounts[0], tickUs);
+    contention(std::max<std::size_t>(tasks, 1), threadCounts, work);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,290 @@
+// SchedulerBench.cpp
+// Micro and macro benchmarks over seeded synthetic workloads: ready-queue
+// throughput through the handle interface and the Job-value shim, full
+// Simulator runs, and CSV loading, at job counts from 10^3 up to 10^7.
+// Results print as a table and, with --json, are written in the layout
+// Google Benchmark uses (context + benchmarks[]), so its compare tooling
+// and CI dashboards can read them.
+// Compile: g++ -std=c++17 -O2 -pthread -Iinclude bench/SchedulerBench.cpp src/WorkloadGenerator.cpp src/Simulator.cpp src/ArrivalSource.cpp src/FCFSScheduler.cpp src/SJFScheduler.cpp src/RoundRobinScheduler.cpp src/PriorityScheduler.cpp src/MLFQScheduler.cpp src/CFSScheduler.cpp src/EDFScheduler.cpp src/LLFScheduler.cpp src/DeadlineAdmission.cpp src/CsvLoader.cpp src/TraceFile.cpp src/Statistics.cpp src/QuantileSketch.cpp src/GanttChart.cpp src/GanttRenderer.cpp src/OutputBuffer.cpp src/EventLog.cpp src/RunArena.cpp src/JobTable.cpp src/Job.cpp -o scheduler_bench
+// Run: ./scheduler_bench [--sizes 1000,10000,100000,1000000] [--filter TEXT] [--min-time SECONDS]
+//                        [--seed N] [--pareto] [--json results.json]
+
+#include "../include/WorkloadGenerator.h"
+#include "../include/ComparisonRunner.h"
+#include "../include/Simulator.h"
+#include "../include/FCFSScheduler.h"
+#include "../include/SJFScheduler.h"
+#include "../include/RoundRobinScheduler.h"
+#include "../include/PriorityScheduler.h"
+#include "../include/MLFQScheduler.h"
+#include "../include/CFSScheduler.h"
+#include "../include/EDFScheduler.h"
+#include "../include/LLFScheduler.h"
+#include "../include/CsvLoader.h"
+#include "../include/TraceFile.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct BenchResult {
+    std::string name;
+    std::string family;
+    std::string scheduler;
+    std::size_t jobs = 0;
+    long long iterations = 0;
+    double realMs = 0;              // mean per iteration
+    double itemsPerSecond = 0;
+    double bytesPerSecond = 0;      // CSV loading only
+};
+
+struct BenchOptions {
+    std::vector<std::size_t> sizes = { 1000, 10000, 100000, 1000000 };
+    std::string filter;
+    double minTime = 0.5;
+    std::string jsonPath;
+    WorkloadSpec workload;
+};
+
+// Keeps benchmarked results alive so the optimiser cannot drop the work
+volatile long long sink = 0;
+
+using Clock = std::chrono::steady_clock;
+
+// Runs prepare() untimed and body(state) timed, repeating until minTime
+// seconds of body time have been spent, at least once
+template <typename Prepare, typename Body>
+BenchResult measure(double minTime, std::size_t items, Prepare prepare, Body body) {
+    BenchResult result;
+    double totalMs = 0;
+    do {
+        auto state = prepare();
+        auto begin = Clock::now();
+        body(state);
+        totalMs += std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+        ++result.iterations;
+    } while (totalMs < minTime * 1000 && result.iterations < 1000000);
+    result.realMs = totalMs / result.iterations;
+    result.itemsPerSecond = result.realMs > 0 ? items / (result.realMs / 1000) : 0;
+    return result;
+}
+
+std::vector<SchedulerConfig> benchSchedulers() {
+    return {
+        { "FCFS", [] { return std::make_unique<FCFSScheduler>(); } },
+        { "SJF", [] { return std::make_unique<SJFScheduler>(); } },
+        { "RR", [] { return std::make_unique<RoundRobinScheduler>(4); } },
+        { "Priority", [] { return std::make_unique<PriorityScheduler>(); } },
+        { "MLFQ", [] { return std::make_unique<MLFQScheduler>(); } },
+        { "CFS", [] { return std::make_unique<CFSScheduler>(); } },
+        { "EDF", [] { return std::make_unique<EDFScheduler>(); } },
+        { "LLF", [] { return std::make_unique<LLFScheduler>(); } },
+    };
+}
+
+std::string formatRate(double perSecond, const char* unit) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2);
+    if (perSecond >= 1e9) oss << perSecond / 1e9 << "G";
+    else if (perSecond >= 1e6) oss << perSecond / 1e6 << "M";
+    else if (perSecond >= 1e3) oss << perSecond / 1e3 << "k";
+    else oss << perSecond;
+    oss << unit << "/s";
+    return oss.str();
+}
+
+class Suite {
+public:
+    explicit Suite(const BenchOptions& options) : options(options) {}
+
+    bool wanted(const std::string& name) const {
+        return options.filter.empty() || name.find(options.filter) != std::string::npos;
+    }
+
+    void report(BenchResult result, const std::string& name, const std::string& family,
+                const std::string& scheduler, std::size_t jobs) {
+        result.name = name;
+        result.family = family;
+        result.scheduler = scheduler;
+        result.jobs = jobs;
+        std::cout << std::left << std::setw(34) << name << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(14) << result.realMs << std::setw(12) << result.iterations
+                  << std::setw(16) << formatRate(result.itemsPerSecond, "");
+        if (result.bytesPerSecond > 0) std::cout << std::setw(14) << formatRate(result.bytesPerSecond, "B");
+        std::cout << std::endl;
+        results.push_back(std::move(result));
+    }
+
+    void run(std::size_t n) {
+        WorkloadSpec spec = options.workload;
+        spec.jobs = n;
+        std::string size = "/" + std::to_string(n);
+
+        if (wanted("Generate" + size)) {
+            report(measure(options.minTime, n, [] { return 0; }, [&](int) {
+                       JobTable jobs;
+                       WorkloadGenerator::generate(spec, jobs);
+                       sink = sink + jobs.size();
+                   }), "Generate" + size, "Generate", "", n);
+        }
+
+        JobTable table;
+        WorkloadGenerator::generate(spec, table);
+        std::shared_ptr<const SharedJobSet> shared;
+
+        for (const auto& config : benchSchedulers()) {
+            std::string suffix = "/" + config.label + size;
+            // Handle interface, as the simulator drives it: n enqueues, n dequeues
+            if (wanted("Queue" + suffix)) {
+                report(measure(options.minTime, 2 * n, [&] {
+                           auto scheduler = config.create();
+                           scheduler->attach(table);
+                           return scheduler;
+                       }, [&](std::unique_ptr<Scheduler>& scheduler) {
+                           for (JobHandle h = 0; h < table.size(); ++h) scheduler->enqueue(h);
+                           scheduler->schedule(0);
+                           long long sum = 0;
+                           while (scheduler->hasJobs()) sum += scheduler->dequeue();
+                           sink = sink + sum;
+                       }), "Queue" + suffix, "Queue", config.label, n);
+            }
+            // Job-value compatibility shim: addJob copies into the scheduler's own table
+            if (wanted("AddGetJob" + suffix)) {
+                report(measure(options.minTime, 2 * n, [&] { return config.create(); },
+                               [&](std::unique_ptr<Scheduler>& scheduler) {
+                                   for (JobHandle h = 0; h < table.size(); ++h) scheduler->addJob(table.toJob(h));
+                                   scheduler->schedule(0);
+                                   long long sum = 0;
+                                   while (scheduler->hasJobs()) sum += scheduler->getNextJob().jobId;
+                                   sink = sink + sum;
+                               }), "AddGetJob" + suffix, "AddGetJob", config.label, n);
+            }
+            if (wanted("Simulate" + suffix)) {
+                if (!shared) shared = SharedJobSet::create(table);
+                report(measure(options.minTime, n, [&] { return config.create(); },
+                               [&](std::unique_ptr<Scheduler>& scheduler) {
+                                   Simulator sim(std::move(scheduler), std::make_unique<SharedArrivalSource>(shared));
+                                   sim.run();
+                                   sink = sink + sim.getCurrentTime();
+                               }), "Simulate" + suffix, "Simulate", config.label, n);
+            }
+        }
+
+        if (wanted("CsvLoad" + size)) {
+            std::filesystem::path path = std::filesystem::temp_directory_path() /
+                                         ("scheduler_bench_" + std::to_string(n) + ".csv");
+            std::string error;
+            if (!TraceFile::writeCsv(path.string(), table, error)) {
+                std::cerr << "CsvLoad" << size << ": " << error << "\n";
+                return;
+            }
+            double bytes = (double)std::filesystem::file_size(path);
+            BenchResult result = measure(options.minTime, n, [] { return 0; }, [&](int) {
+                JobTable jobs;
+                CsvJobLoader::load(path.string(), jobs);
+                sink = sink + jobs.size();
+            });
+            result.bytesPerSecond = result.realMs > 0 ? bytes / (result.realMs / 1000) : 0;
+            report(result, "CsvLoad" + size, "CsvLoad", "", n);
+            std::filesystem::remove(path);
+        }
+    }
+
+    bool writeJson(const std::string& path) const {
+        std::ofstream out(path);
+        if (!out) return false;
+        char date[32];
+        std::time_t now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+        const WorkloadSpec& spec = options.workload;
+        out << std::setprecision(10);
+        out << "{\n  \"context\": {\n"
+            << "    \"date\": \"" << date << "\",\n"
+            << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+#ifdef NDEBUG
+            << "    \"library_build_type\": \"release\",\n"
+#else
+            << "    \"library_build_type\": \"debug\",\n"
+#endif
+            << "    \"min_time\": " << options.minTime << ",\n"
+            << "    \"workload\": { \"seed\": " << spec.seed << ", \"arrival_rate\": " << spec.arrivalRate
+            << ", \"bursts\": \"" << (spec.bursts == BurstDistribution::Pareto ? "pareto" : "exponential")
+            << "\", \"mean_burst\": " << spec.meanBurst << ", \"pareto_shape\": " << spec.paretoShape
+            << ", \"priority_levels\": " << spec.priorityLevels << ", \"priority_skew\": " << spec.prioritySkew
+            << ", \"deadline_slack\": " << spec.deadlineSlack << " }\n"
+            << "  },\n  \"benchmarks\": [";
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const BenchResult& r = results[i];
+            out << (i ? ",\n" : "\n") << "    { \"name\": \"" << r.name << "\", \"family\": \"" << r.family
+                << "\", \"scheduler\": \"" << r.scheduler << "\", \"jobs\": " << r.jobs
+                << ", \"iterations\": " << r.iterations << ", \"real_time\": " << r.realMs
+                << ", \"time_unit\": \"ms\", \"items_per_second\": " << r.itemsPerSecond;
+            if (r.bytesPerSecond > 0) out << ", \"bytes_per_second\": " << r.bytesPerSecond;
+            out << " }";
+        }
+        out << "\n  ]\n}\n";
+        return (bool)out;
+    }
+
+private:
+    const BenchOptions& options;
+    std::vector<BenchResult> results;
+};
+
+// Accepts "1000,1e6"
+std::vector<std::size_t> parseSizes(const std::string& list) {
+    std::vector<std::size_t> sizes;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        double value = std::strtod(item.c_str(), nullptr);
+        if (value >= 1) sizes.push_back((std::size_t)value);
+    }
+    return sizes;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    // Deadlines a few bursts out, so EDF and LLF have something to order by
+    options.workload.deadlineSlack = 4;
+    options.workload.seed = 42;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--sizes" && hasValue) options.sizes = parseSizes(argv[++i]);
+        else if (arg == "--filter" && hasValue) options.filter = argv[++i];
+        else if (arg == "--min-time" && hasValue) options.minTime = std::max(0.0, std::atof(argv[++i]));
+        else if (arg == "--seed" && hasValue) options.workload.seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--pareto") options.workload.bursts = BurstDistribution::Pareto;
+        else if (arg == "--json" && hasValue) options.jsonPath = argv[++i];
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--sizes 1000,10000,100000,1000000] [--filter TEXT]"
+                      << " [--min-time SECONDS]\n"
+                      << "       [--seed N] [--pareto] [--json results.json]\n";
+            return 2;
+        }
+    }
+
+    Suite suite(options);
+    std::cout << std::left << std::setw(34) << "Benchmark" << std::right << std::setw(14) << "Time (ms)"
+              << std::setw(12) << "Iterations" << std::setw(16) << "Items" << std::setw(14) << "Bytes" << "\n"
+              << std::string(90, '-') << "\n";
+    for (std::size_t n : options.sizes) suite.run(n);
+    if (!options.jsonPath.empty() && !suite.writeJson(options.jsonPath)) {
+        std::cerr << "Cannot write " << options.jsonPath << "\n";
+        return 1;
+    }
+    return 0;
+}
\ No newline at end of file
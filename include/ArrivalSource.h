@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Job.h"
+#include "JobTable.h"
+#include <vector>
+#include <functional>
+#include <memory>
+
+// Feeds jobs to the simulator in non-decreasing arrival order, so admission
+// is a cursor move instead of a scan over every job that has not arrived yet.
+class ArrivalSource {
+public:
+    virtual bool hasNext() = 0;
+    virtual int peekArrivalTime() = 0;
+    virtual Job next() = 0;
+    // Moves the next job into the simulator's table. Sources backed by a
+    // table override this to copy the row without building a Job.
+    virtual JobHandle admit(JobTable& into) { return into.add(next()); }
+    virtual ~ArrivalSource() {}
+};
+
+// In-memory job set, stable-sorted by arrival time once up front
+class VectorArrivalSource : public ArrivalSource {
+public:
+    explicit VectorArrivalSource(std::vector<Job> jobs);
+    bool hasNext() override;
+    int peekArrivalTime() override;
+    Job next() override;
+
+private:
+    std::vector<Job> jobs;
+    size_t cursor;
+};
+
+// Pulls jobs one at a time from a file reader or workload generator. The
+// producer returns false when it runs dry and should yield jobs in arrival
+// order; a late job is simply admitted at the next admission point.
+class GeneratorArrivalSource : public ArrivalSource {
+public:
+    explicit GeneratorArrivalSource(std::function<bool(Job&)> producer);
+    bool hasNext() override;
+    int peekArrivalTime() override;
+    Job next() override;
+
+private:
+    std::function<bool(Job&)> producer;
+    Job lookahead;
+    bool buffered;
+    bool exhausted;
+    void fill();
+};
+
+// Immutable job set that concurrent simulations read from: the table plus
+// its handles in stable arrival order, sorted once when the set is built.
+class SharedJobSet {
+public:
+    static std::shared_ptr<const SharedJobSet> create(JobTable jobs);
+    static std::shared_ptr<const SharedJobSet> create(const std::vector<Job>& jobs);
+
+    const JobTable& table() const { return jobs; }
+    const std::vector<JobHandle>& arrivalOrder() const { return order; }
+    std::size_t size() const { return jobs.size(); }
+
+private:
+    JobTable jobs;
+    std::vector<JobHandle> order;
+};
+
+// Cursor over a shared job set; each simulator gets its own. A resumed run
+// starts the cursor past the jobs its checkpoint already admitted.
+class SharedArrivalSource : public ArrivalSource {
+public:
+    explicit SharedArrivalSource(std::shared_ptr<const SharedJobSet> jobs, size_t start = 0);
+    bool hasNext() override;
+    int peekArrivalTime() override;
+    Job next() override;
+    JobHandle admit(JobTable& into) override;
+
+private:
+    std::shared_ptr<const SharedJobSet> jobs;
+    size_t cursor;
+};
\ No newline at end of file
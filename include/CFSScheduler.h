@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Scheduler.h"
+#include <cstdint>
+#include <set>
+#include <vector>
+
+// Completely fair scheduling in the style of Linux CFS. Each job accrues
+// virtual runtime at a rate inversely proportional to its weight, and the
+// job with the least virtual runtime runs next. Weights come from
+// Job::priority read as a nice value (lower = higher priority, clamped to
+// -20..19, 0 = weight 1024). Ready jobs sit in a red-black tree
+// (std::set) keyed by virtual runtime, so enqueue and pick-next are
+// O(log n) however many jobs are waiting.
+class CFSScheduler : public Scheduler {
+public:
+    // targetLatency is the period in which every ready job should run once;
+    // with more than targetLatency / minGranularity jobs the period
+    // stretches so no slice is shorter than minGranularity
+    explicit CFSScheduler(int targetLatency = 6, int minGranularity = 1);
+    void enqueue(JobHandle job) override;
+    JobHandle dequeue() override;
+    bool hasJobs() const override;
+    void schedule(int currentTime) override;
+    void setJobs(const std::vector<Job>& jobs) override;
+    void attach(JobTable& jobs) override;
+    std::string getGanttChart() const override;
+    std::string getTimelineLog() const override;
+    std::string getStatistics() const override;
+    int timeSlice(JobHandle job, int currentTime) const override;
+    std::vector<JobHandle> queuedJobs() const override;
+    std::string configKey() const override {
+        return "CFS latency=" + std::to_string(targetLatency) + " granularity=" + std::to_string(minGranularity);
+    }
+    void recycle(JobHandle job) override;
+    ~CFSScheduler() override;
+
+    static int weightOf(int priority);
+    // Virtual runtime in 1/1024ths of a time unit at weight 1024
+    std::int64_t vruntimeOf(JobHandle job) const { return job < vruntime.size() ? vruntime[job] : 0; }
+
+private:
+    struct Key {
+        std::int64_t vruntime;
+        std::uint64_t seq;      // ties run in the order they were queued
+        JobHandle job;
+        bool operator<(const Key& other) const {
+            return vruntime != other.vruntime ? vruntime < other.vruntime : seq < other.seq;
+        }
+    };
+    std::pmr::set<Key> timeline;
+    std::pmr::vector<std::int64_t> vruntime;     // per handle
+    std::pmr::vector<int> dispatchedRemaining;   // remaining time when dispatched, -1 otherwise
+    std::pmr::vector<char> placed;               // has been queued before
+    std::int64_t minVruntime;               // never goes backwards
+    std::int64_t queuedWeight;
+    std::uint64_t nextSeq;
+    int targetLatency;
+    int minGranularity;
+};
\ No newline at end of file
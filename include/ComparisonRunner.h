@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Scheduler.h"
+#include "ArrivalSource.h"
+#include "QuantileSketch.h"
+#include "ResultCache.h"
+#include "Statistics.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// A named way of building a fresh scheduler
+struct SchedulerConfig {
+    std::string label;
+    std::function<std::unique_ptr<Scheduler>()> create;
+};
+
+struct ComparisonResult {
+    std::string label;
+    RunStatistics stats;
+    double wallMs = 0;   // time spent simulating this config
+    bool cached = false; // came from the result cache; wallMs is the lookup
+    bool cancelled = false; // stopped by ComparisonOptions::cancel; stats are empty
+    // With ComparisonOptions::sketches: what `stats` was computed from, for
+    // merging with the same config's results over other job sets
+    std::shared_ptr<const RunSketches> sketches;
+};
+
+struct ComparisonOptions {
+    ResultCache* cache = nullptr;
+    // Statistics from quantile sketches fed as each run goes, instead of an
+    // exact pass over its job table afterwards
+    bool sketches = false;
+    // Set from another thread to stop early: configs not finished by then
+    // come back marked cancelled
+    const std::atomic<bool>* cancel = nullptr;
+    // Called from the worker threads as each config finishes, in whatever
+    // order they do; must be thread-safe
+    std::function<void(const ComparisonResult&)> onResult;
+};
+
+// Runs several scheduler configurations against the same job set at once.
+// Each configuration gets its own Simulator; all of them read one shared,
+// immutable job table.
+class ComparisonRunner {
+public:
+    // FCFS, SJF, Round Robin at a few quanta, Priority over a small aging grid, MLFQ, CFS,
+    // EDF (with and without admission control) and LLF
+    static std::vector<SchedulerConfig> defaultConfigs();
+    // The config a label names: one of the defaults, or "RR q=<quantum>" /
+    // "Priority t=<threshold> i=<increment>" for any knob values. Lets a
+    // config travel as its label, e.g. to a sweep worker.
+    static bool findConfig(const std::string& label, SchedulerConfig& into);
+
+    // Results come back in config order. With a cache, configs that ran on
+    // this job set before are not simulated again, and new runs are kept.
+    static std::vector<ComparisonResult> run(std::shared_ptr<const SharedJobSet> jobs,
+                                             const std::vector<SchedulerConfig>& configs,
+                                             ThreadPool& pool, ResultCache* cache = nullptr);
+    static std::vector<ComparisonResult> run(std::shared_ptr<const SharedJobSet> jobs,
+                                             const std::vector<SchedulerConfig>& configs,
+                                             ThreadPool& pool, const ComparisonOptions& options);
+    static std::vector<ComparisonResult> run(std::shared_ptr<const SharedJobSet> jobs,
+                                             const std::vector<SchedulerConfig>& configs,
+                                             unsigned threads = 0, ResultCache* cache = nullptr);
+
+    // A single config on the calling thread, as run() runs each one
+    static ComparisonResult runConfig(std::shared_ptr<const SharedJobSet> jobs, const SchedulerConfig& config,
+                                      const ComparisonOptions& options = ComparisonOptions());
+
+    // One row per configuration, metrics side by side
+    static std::string formatTable(const std::vector<ComparisonResult>& results);
+};
\ No newline at end of file
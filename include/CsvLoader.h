@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Job.h"
+#include "JobTable.h"
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct CsvRowError {
+    std::size_t line;
+    std::string message;
+};
+
+struct CsvLoadResult {
+    bool opened = false;
+    std::size_t rows = 0;                // jobs loaded
+    std::size_t errorCount = 0;          // rows skipped
+    std::vector<CsvRowError> errors;     // the first kMaxReportedErrors of them
+
+    static constexpr std::size_t kMaxReportedErrors = 100;
+};
+
+// Job CSV reader for large dumps. The file is memory-mapped where the
+// platform allows it and read in large blocks otherwise; fields are parsed
+// in place with std::from_chars, so no per-line string or stream is built.
+//
+// Rows are either `id,arrival,burst,priority` or `name,arrival,burst,priority`,
+// optionally followed by a `deadline` column (absolute time; empty means none).
+// An optional header naming the first column `id` or `name` is skipped.
+// Malformed rows are reported and skipped; loading carries on.
+class CsvJobLoader {
+public:
+    // Called once per parsed row; `name` is empty for id rows and `deadline`
+    // is kNoDeadline when the row has none
+    using RowSink = std::function<void(int id, std::string_view name, int arrival, int burst, int priority, int deadline)>;
+
+    // Appends straight into the table
+    static CsvLoadResult load(const std::string& path, JobTable& jobs);
+    // Id rows become Job(id, ...); name rows get sequential ids from 1
+    static CsvLoadResult load(const std::string& path, std::vector<Job>& jobs);
+    static CsvLoadResult load(const std::string& path, const RowSink& sink);
+
+    // The same parser over an in-memory buffer
+    static CsvLoadResult parse(std::string_view text, const RowSink& sink);
+};
\ No newline at end of file
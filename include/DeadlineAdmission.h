@@ -0,0 +1,20 @@
+#pragma once
+
+#include "JobTable.h"
+#include <memory_resource>
+#include <vector>
+
+// Admission test shared by the deadline schedulers. Serving queued work in
+// deadline order on one CPU from the new job's arrival, the job is accepted
+// when it would meet its deadline and would not push any queued job that is
+// currently on time past its own. EDF is optimal on one CPU, so a rejected
+// job could only be saved by letting another one miss.
+//
+// Both schedulers preempt on arrival, so the simulator admits a job at its
+// arrival time with the preempted job back in the queue; the queue then
+// holds all the outstanding work. The test sorts the queued deadline jobs,
+// O(q log q) per arrival, and only runs when admission control is enabled.
+class DeadlineAdmission {
+public:
+    static bool admit(JobHandle job, const std::pmr::vector<JobHandle>& queued, const JobTable& jobs);
+};
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "ComparisonRunner.h"
+#include "QuantileSketch.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// A contiguous run of a trace's jobs in arrival order, replayed on its own:
+// the queue starts empty at its first arrival rather than carrying over the
+// previous segment's backlog
+struct TraceSegment {
+    std::string name;                           // "<file>" or "<file>#<index>"
+    std::size_t jobs = 0;
+    std::shared_ptr<const std::string> trace;   // the jobs in the trace format, see TraceFile::encodeJobs
+};
+
+// What one (config, segment) task came to
+struct ShardResult {
+    std::size_t config = 0;
+    std::size_t segment = 0;
+    bool done = false;
+    std::string error;          // why it did not finish: the worker's error, or too many lost workers
+    RunSketches sketches;       // done only
+    double wallMs = 0;          // simulation time on the worker
+    std::string worker;
+    int attempts = 0;           // workers it was handed to
+};
+
+struct CoordinatorOptions {
+    std::uint16_t port = 7070;
+    // A task whose worker disconnects goes back in the queue, up to this many
+    // times in all
+    int maxAttempts = 3;
+    // Workers joining and leaving, and each finished task; called on the
+    // coordinator's thread
+    std::function<void(const std::string&)> log;
+};
+
+// Config x trace-segment sweeps spread over machines. A coordinator listens
+// for workers and keeps each one as many tasks ahead as it has threads; a
+// worker connects, receives each segment it needs once, runs tasks through
+// ComparisonRunner::runConfig with sketches on, and sends back only the
+// run's RunSketches. Configs travel as labels (ComparisonRunner::findConfig).
+// Everything on the wire is little-endian (WireFormat.h), apart from the
+// segments, which are trace files and carry their own byte-order tag.
+class DistributedSweep {
+public:
+    static constexpr std::uint32_t kProtocolVersion = 2;
+
+    // Loads each trace and splits it every `jobsPerSegment` jobs in arrival
+    // order; 0 keeps each file whole
+    static bool segmentTraces(const std::vector<std::string>& paths, std::size_t jobsPerSegment,
+                              std::vector<TraceSegment>& into, std::string& error);
+
+    // Serves every config x segment task to the workers that connect, and
+    // returns once each has finished or been given up on. Results come back
+    // config-major: results[config * segments.size() + segment]. False only
+    // if a config is unknown or the port cannot be listened on.
+    static bool coordinate(const std::vector<std::string>& configs, const std::vector<TraceSegment>& segments,
+                           const CoordinatorOptions& options, std::vector<ShardResult>& results, std::string& error);
+
+    // Connects to a coordinator and runs its tasks on `threads` threads (0 =
+    // one per hardware thread) until it says the sweep is over. False if the
+    // connection fails or drops first.
+    static bool work(const std::string& host, std::uint16_t port, unsigned threads, std::string& error,
+                     const std::function<void(const std::string&)>& log = {});
+
+    // Each config's finished shards merged into one result over all its
+    // segments (RunSketches::mergeShard, so makespans add up), for
+    // ComparisonRunner::formatTable; a config with none finished comes
+    // back cancelled
+    static std::vector<ComparisonResult> mergeByConfig(const std::vector<std::string>& configs,
+                                                       const std::vector<ShardResult>& results);
+    // One row per shard
+    static bool writeCsv(const std::string& path, const std::vector<std::string>& configs,
+                         const std::vector<TraceSegment>& segments, const std::vector<ShardResult>& results,
+                         std::string& error);
+};
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Scheduler.h"
+#include "IndexedHeap.h"
+#include "DeadlineAdmission.h"
+#include <vector>
+
+// Earliest deadline first. The queued job with the nearest deadline runs,
+// and an arrival with an earlier one preempts it. Jobs without a deadline
+// come after every job that has one, in arrival order.
+//
+// With admission control a job is turned away on arrival when the work due
+// before it leaves too little time to meet its deadline (DeadlineAdmission);
+// it never runs, and the statistics count it as a miss.
+class EDFScheduler : public Scheduler {
+public:
+    explicit EDFScheduler(bool admissionControl = false);
+    void enqueue(JobHandle job) override;
+    JobHandle dequeue() override;
+    bool hasJobs() const override;
+    void schedule(int currentTime) override;
+    void setJobs(const std::vector<Job>& jobs) override;
+    void attach(JobTable& jobs) override;
+    std::string getGanttChart() const override;
+    std::string getTimelineLog() const override;
+    std::string getStatistics() const override;
+    bool preemptsOnArrival() const override { return true; }
+    std::vector<JobHandle> queuedJobs() const override;
+    // Admission decisions depend on what was admitted before
+    bool resumesFromQueue() const override { return !admissionControl; }
+    // The rejected list is part of the report, so admission runs are not cached
+    std::string configKey() const override { return admissionControl ? "" : "EDF"; }
+    void recycle(JobHandle job) override;
+    void takeRejected(std::vector<JobHandle>& into) override;
+    ~EDFScheduler() override;
+
+    const std::pmr::vector<JobHandle>& rejectedJobs() const { return rejected; }
+
+private:
+    struct EarlierDeadline {
+        const EDFScheduler* owner;
+        bool operator()(JobHandle a, JobHandle b) const;
+    };
+    IndexedHeap<EarlierDeadline> readyQueue;
+    std::pmr::vector<char> admitted;     // per handle: passed admission once
+    std::pmr::vector<JobHandle> rejected;
+    bool admissionControl;
+};
\ No newline at end of file
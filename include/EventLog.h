@@ -0,0 +1,85 @@
+#pragma once
+
+#include "JobTable.h"
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+// Build with -DEVENT_LOG_ENABLED=0 to compile recording out entirely
+#ifndef EVENT_LOG_ENABLED
+#define EVENT_LOG_ENABLED 1
+#endif
+
+enum class EventType : std::uint8_t {
+    Arrive,
+    Start,      // first dispatch
+    Preempt,    // another job took the CPU while this one had work left
+    Resume,     // dispatched again after a preemption
+    Complete
+};
+
+struct TimelineEvent {
+    std::int32_t time;
+    JobHandle job;
+    EventType type;
+};
+static_assert(sizeof(TimelineEvent) == 12, "timeline events should stay 12 bytes");
+
+// Append-only log of fixed-size timeline events. Events go into fixed-size
+// chunks taken from a memory resource, so appending never moves what is
+// already recorded and a run arena can back the whole log. Text is produced
+// only by format(), never while the run is going.
+//
+// Recording can be switched off per log (setEnabled) or for the whole build
+// (EVENT_LOG_ENABLED=0), in which case record() is an empty inline.
+class EventLog {
+public:
+    static constexpr std::size_t kChunkEvents = 1024;
+
+    EventLog() = default;
+    explicit EventLog(std::pmr::memory_resource* memory) : chunks(memory) {}
+    EventLog(const EventLog& other, std::pmr::memory_resource* memory) : EventLog(other, other.size(), memory) {}
+    // Copy of the first n events
+    EventLog(const EventLog& other, std::size_t n, std::pmr::memory_resource* memory);
+    EventLog(const EventLog& other) : EventLog(other, std::pmr::get_default_resource()) {}
+    EventLog(EventLog&& other) noexcept;
+    // Takes the chunks over when they already come from `memory`
+    EventLog(EventLog&& other, std::pmr::memory_resource* memory);
+    EventLog& operator=(const EventLog& other);
+    EventLog& operator=(EventLog&& other);
+    ~EventLog();
+
+    void record(int time, JobHandle job, EventType type) {
+#if EVENT_LOG_ENABLED
+        if (!on) return;
+        if (count == chunks.size() * kChunkEvents) addChunk();
+        chunks[count / kChunkEvents][count % kChunkEvents] = { time, job, type };
+        ++count;
+#else
+        (void)time; (void)job; (void)type;
+#endif
+    }
+
+    bool enabled() const { return EVENT_LOG_ENABLED && on; }
+    void setEnabled(bool enabled) { on = enabled; }
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const TimelineEvent& operator[](std::size_t i) const { return chunks[i / kChunkEvents][i % kChunkEvents]; }
+    // Allocates chunks up front for n events in total
+    void reserve(std::size_t n);
+    // Keeps the chunks for reuse
+    void clear() { count = 0; }
+
+    // One line per event with the job's name, then a legend
+    std::string format(const JobTable& jobs) const;
+    static char symbol(EventType type);
+
+private:
+    std::pmr::vector<TimelineEvent*> chunks;
+    std::size_t count = 0;
+    bool on = true;
+
+    void addChunk();
+    void freeChunks();
+};
\ No newline at end of file
@@ -1,23 +1,29 @@
 #pragma once
 
 #include "Scheduler.h"
-#include <queue>
+#include "HandleQueue.h"
 
-class FCFSScheduler : public Scheduler {
+// Final, with the per-dispatch calls defined here, so the simulator's
+// FCFS loop calls them directly and can inline them
+class FCFSScheduler final : public Scheduler {
 public:
     FCFSScheduler();
-    void addJob(const Job& job) override;
-    Job getNextJob() override;
-    bool hasJobs() const override;
-    void schedule(int currentTime) override;
+    void enqueue(JobHandle job) override { fcfsQueue.push_back(job); }
+    // kNoJob on an empty queue (should be handled by caller)
+    JobHandle dequeue() override { return fcfsQueue.empty() ? kNoJob : fcfsQueue.pop_front(); }
+    bool hasJobs() const override { return !fcfsQueue.empty(); }
+    // FCFS does not require sorting or preemption
+    void schedule(int currentTime) override {}
     void setJobs(const std::vector<Job>& jobs) override;
+    void attach(JobTable& jobs) override;
     std::string getGanttChart() const override;
     std::string getTimelineLog() const override;
     std::string getStatistics() const override;
+    std::vector<JobHandle> queuedJobs() const override;
+    bool resumesFromQueue() const override { return true; }
+    std::string configKey() const override { return "FCFS"; }
     ~FCFSScheduler() override;
 
 private:
-    std::queue<Job> fcfsQueue;
-    std::vector<Job> scheduledJobs;
-    std::vector<std::string> timelineLog;
+    HandleQueue fcfsQueue;
 };
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "JobTable.h"
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+// One uninterrupted stretch of CPU time given to a job
+struct GanttSegment {
+    JobHandle job;
+    int start;
+    int length;
+    int end() const { return start + length; }
+};
+
+// Execution history stored as run-length segments. A segment is appended only
+// when the running job changes or the CPU went idle in between, so memory
+// grows with context switches rather than with simulated time.
+class GanttChart {
+public:
+    GanttChart() = default;
+    explicit GanttChart(std::pmr::memory_resource* memory) : runs(memory) {}
+    GanttChart(const GanttChart& other, std::pmr::memory_resource* memory) : runs(other.runs, memory), on(other.on) {}
+    GanttChart(const GanttChart& other) : runs(other.runs, std::pmr::get_default_resource()), on(other.on) {}
+    GanttChart(GanttChart&&) = default;
+    GanttChart(GanttChart&& other, std::pmr::memory_resource* memory) : runs(std::move(other.runs), memory), on(other.on) {}
+    GanttChart& operator=(const GanttChart&) = default;
+    GanttChart& operator=(GanttChart&&) = default;
+
+    void record(JobHandle job, int start, int length);
+    // Off for runs that keep no history, e.g. streaming ones whose handles
+    // are reused; record() then does nothing
+    bool enabled() const { return on; }
+    void setEnabled(bool enabled) { on = enabled; }
+    void clear() { runs.clear(); }
+    // Back to the first n segments, the last of them `lastLength` long (it
+    // may have been extended since)
+    void truncate(std::size_t n, int lastLength) {
+        if (n < runs.size()) runs.resize(n);
+        if (n > 0 && n <= runs.size()) runs[n - 1].length = lastLength;
+    }
+    void reserve(std::size_t n) { runs.reserve(n); }
+    bool empty() const { return runs.empty(); }
+    std::size_t size() const { return runs.size(); }
+    const std::pmr::vector<GanttSegment>& segments() const { return runs; }
+
+    // Colored segment bar with start times and per-job labels, downsampled
+    // to the terminal's width when that would not fit (see GanttRenderer.h)
+    std::string render(const JobTable& jobs) const;
+
+private:
+    std::pmr::vector<GanttSegment> runs;
+    bool on = true;
+};
\ No newline at end of file
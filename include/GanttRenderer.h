@@ -0,0 +1,48 @@
+#pragma once
+
+#include "GanttChart.h"
+#include "EventLog.h"
+#include "JobTable.h"
+#include "OutputBuffer.h"
+#include <limits>
+#include <string>
+#include <vector>
+
+// The part of a schedule to draw and how wide to draw it. The time range is
+// clipped to the schedule, so the defaults show all of it.
+struct GanttView {
+    int from = std::numeric_limits<int>::min();    // [from, to) in simulated time
+    int to = std::numeric_limits<int>::max();
+    int width = 0;          // terminal columns or SVG pixels; 0 = the terminal's width / 1200 px
+    bool color = true;      // ANSI colors in text output
+};
+
+// Gantt charts rendered in time proportional to what is shown rather than to
+// the length of the schedule. Text goes into an OutputBuffer, not a stream,
+// and out in a single write. A chart whose labelled segments fit in
+// kDetailedLines terminal lines is drawn segment by segment, as
+// GanttChart::render always has. A longer one is downsampled: each column is
+// an equal slice of time, shown in the color of the job that ran most in it.
+// The file exports are meant for schedules too large for a terminal.
+class GanttRenderer {
+public:
+    static constexpr int kDetailedLines = 8;
+
+    static void renderText(const GanttChart& gantt, const JobTable& jobs, const GanttView& view, OutputBuffer& out);
+    // renderText to standard output in one write
+    static void print(const GanttChart& gantt, const JobTable& jobs, const GanttView& view = GanttView());
+
+    // Chrome trace event JSON, for chrome://tracing or Perfetto. Each lane
+    // becomes a thread with one complete event per segment; one simulated
+    // time unit shows as a microsecond. `events`, when given, adds the
+    // timeline as instant events on a thread of its own.
+    static bool writeChromeTrace(const std::string& path, const std::vector<const GanttChart*>& lanes,
+                                 const JobTable& jobs, std::string& error, const EventLog* events = nullptr);
+    // One row per lane, downsampled to the view's width in pixels; runs of
+    // columns with the same job are merged into one rectangle
+    static bool writeSvg(const std::string& path, const std::vector<const GanttChart*>& lanes,
+                         const JobTable& jobs, const GanttView& view, std::string& error);
+
+    // Columns of the terminal on standard output, else $COLUMNS, else 80
+    static int terminalWidth();
+};
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "JobTable.h"
+#include <memory_resource>
+#include <vector>
+
+// FIFO of job handles in a power-of-two ring buffer. Unlike std::deque it
+// allocates nothing until the first push and then only when it outgrows the
+// ring, so it can live in a run's arena. Pushing at the front is allowed too.
+class HandleQueue {
+public:
+    explicit HandleQueue(std::pmr::memory_resource* memory = std::pmr::get_default_resource()) : ring(memory) {}
+
+    bool empty() const { return count == 0; }
+    std::size_t size() const { return count; }
+    JobHandle front() const { return ring[head]; }
+    // i-th handle from the front
+    JobHandle operator[](std::size_t i) const { return ring[(head + i) & (ring.size() - 1)]; }
+
+    void push_back(JobHandle job) {
+        if (count == ring.size()) grow();
+        ring[(head + count) & (ring.size() - 1)] = job;
+        ++count;
+    }
+    void push_front(JobHandle job) {
+        if (count == ring.size()) grow();
+        head = (head + ring.size() - 1) & (ring.size() - 1);
+        ring[head] = job;
+        ++count;
+    }
+    JobHandle pop_front() {
+        JobHandle job = ring[head];
+        head = (head + 1) & (ring.size() - 1);
+        --count;
+        return job;
+    }
+
+    // Appends the handles front to back
+    void copyTo(std::vector<JobHandle>& out) const {
+        for (std::size_t i = 0; i < count; ++i) out.push_back((*this)[i]);
+    }
+
+    void clear() { head = count = 0; }
+    // Also gives the ring back to its memory resource
+    void release() {
+        std::pmr::vector<JobHandle>(ring.get_allocator()).swap(ring);
+        head = count = 0;
+    }
+
+private:
+    std::pmr::vector<JobHandle> ring;
+    std::size_t head = 0;
+    std::size_t count = 0;
+
+    void grow() {
+        std::pmr::vector<JobHandle> bigger(ring.empty() ? 16 : ring.size() * 2, kNoJob, ring.get_allocator());
+        for (std::size_t i = 0; i < count; ++i) bigger[i] = (*this)[i];
+        ring.swap(bigger);
+        head = 0;
+    }
+};
\ No newline at end of file
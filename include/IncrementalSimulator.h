@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Simulator.h"
+#include "ArrivalSource.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+// How the last IncrementalSimulator::update() got its result
+struct IncrementalUpdate {
+    bool changed = false;           // the job set differed from the last one
+    bool resumed = false;           // carried on from a mark instead of time 0
+    int resumedAt = 0;
+    int convergedAt = -1;           // where the old run's tail was spliced on; -1 if none
+    long long steps = 0;            // simulator steps actually taken
+};
+
+// Keeps the latest run of a job set for a scheduler and brings it up to
+// date after edits to the set without simulating everything again.
+//
+// Runs leave SimulatorMarks every few thousand steps. An edit (any stretch
+// of jobs replaced, inserted or erased) cannot affect anything before the
+// earliest arrival it touches, so the new run resumes from the last mark
+// before that. From there it is compared with the old run wherever both
+// reach the same step boundary: once every edited job is done with and the
+// same unchanged jobs are queued in the same order with the same progress,
+// the rest of the old run is what the new one would do, and its tail is
+// spliced on instead of simulated.
+//
+// Only schedulers that resume exactly from their queue
+// (Scheduler::resumesFromQueue) take that path; the others, plugins by
+// default, are simulated from the start on every change.
+class IncrementalSimulator {
+public:
+    using SchedulerMaker = std::function<std::unique_ptr<Scheduler>()>;
+
+    // Marks every `markInterval` steps; 0 picks one from the job count
+    explicit IncrementalSimulator(SchedulerMaker make, long long markInterval = 0);
+
+    // The run over `jobs`, re-simulated only as far as the change since the
+    // last call requires; null when the maker gives no scheduler
+    const Simulator* update(const std::vector<Job>& jobs);
+    // Drops the kept run, e.g. once the maker builds a different scheduler
+    void reset();
+
+    const Simulator* result() const { return current.get(); }
+    const IncrementalUpdate& lastUpdate() const { return last; }
+    std::size_t markCount() const { return marks.size(); }
+
+private:
+    // Jobs [begin, oldEnd) of the previous set became [begin, newEnd)
+    struct Edit {
+        std::size_t begin = 0, oldEnd = 0, newEnd = 0;
+        int earliestArrival = 0;
+        std::size_t oldAdmitted = 0;    // arrival positions past every edited job
+        std::size_t newAdmitted = 0;
+    };
+
+    SchedulerMaker make;
+    long long requestedInterval;
+    long long interval = 0;
+    std::size_t markedQueue = 0;        // queued handles held by all marks together
+    std::shared_ptr<const SharedJobSet> jobSet;
+    std::unique_ptr<Simulator> current;
+    std::vector<SimulatorMark> marks;
+    IncrementalUpdate last;
+
+    void addMark(std::vector<SimulatorMark>& into, SimulatorMark mark, std::size_t jobs);
+    bool matches(const SimulatorMark& now, const SimulatorMark& old, const Edit& edit,
+                 const SharedJobSet& next) const;
+    // The finished run: `sim` (whose state it takes) up to the join at
+    // marks[oldMark], the old run from there on
+    std::unique_ptr<Simulator> splice(std::unique_ptr<Scheduler> scheduler, Simulator& sim,
+                                      const SimulatorMark& now, std::size_t oldMark,
+                                      std::shared_ptr<const SharedJobSet> next, std::vector<SimulatorMark>& into);
+};
\ No newline at end of file
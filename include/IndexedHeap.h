@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+#include <limits>
+#include <utility>
+
+// d-ary min-heap of small integer ids. Keys live outside the heap and are
+// compared through `Less`; a position index lets an entry be re-keyed or
+// removed in O(log n) instead of rebuilding the whole queue.
+template <typename Less, unsigned Arity = 4>
+class IndexedHeap {
+public:
+    static constexpr std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+
+    explicit IndexedHeap(Less less = Less(), std::pmr::memory_resource* memory = std::pmr::get_default_resource())
+        : heap(memory), pos(memory), less(std::move(less)) {}
+
+    bool empty() const { return heap.empty(); }
+    std::size_t size() const { return heap.size(); }
+    bool contains(std::uint32_t id) const { return id < pos.size() && pos[id] != npos; }
+    std::uint32_t top() const { return heap.front(); }
+    // Entries in heap order, for read-only scans
+    const std::pmr::vector<std::uint32_t>& items() const { return heap; }
+
+    void push(std::uint32_t id) {
+        if (id >= pos.size()) pos.resize(id + 1, npos);
+        pos[id] = (std::uint32_t)heap.size();
+        heap.push_back(id);
+        siftUp(heap.size() - 1);
+    }
+
+    std::uint32_t pop() {
+        std::uint32_t id = heap.front();
+        removeAt(0);
+        return id;
+    }
+
+    void remove(std::uint32_t id) {
+        if (contains(id)) removeAt(pos[id]);
+    }
+
+    // Restore order after the key of `id` changed in either direction
+    void update(std::uint32_t id) {
+        if (!contains(id)) return;
+        std::size_t i = pos[id];
+        siftUp(i);
+        siftDown(pos[id]);
+    }
+
+    // Re-establish order after many keys changed at once, in O(n)
+    void rebuild() {
+        for (std::size_t i = heap.size(); i-- > 0;) siftDown(i);
+    }
+
+    void clear() {
+        for (std::uint32_t id : heap) pos[id] = npos;
+        heap.clear();
+    }
+
+    // Empties the heap and gives its storage back to the memory resource
+    void release() {
+        std::pmr::vector<std::uint32_t>(heap.get_allocator()).swap(heap);
+        std::pmr::vector<std::uint32_t>(pos.get_allocator()).swap(pos);
+    }
+
+    void reserve(std::size_t n) {
+        heap.reserve(n);
+        pos.reserve(n);
+    }
+
+private:
+    std::pmr::vector<std::uint32_t> heap;
+    std::pmr::vector<std::uint32_t> pos;   // id -> index in heap, npos when absent
+    Less less;
+
+    void place(std::size_t i, std::uint32_t id) {
+        heap[i] = id;
+        pos[id] = (std::uint32_t)i;
+    }
+
+    void siftUp(std::size_t i) {
+        std::uint32_t id = heap[i];
+        while (i > 0) {
+            std::size_t parent = (i - 1) / Arity;
+            if (!less(id, heap[parent])) break;
+            place(i, heap[parent]);
+            i = parent;
+        }
+        place(i, id);
+    }
+
+    void siftDown(std::size_t i) {
+        std::uint32_t id = heap[i];
+        std::size_t n = heap.size();
+        while (true) {
+            std::size_t first = i * Arity + 1;
+            if (first >= n) break;
+            std::size_t last = first + Arity < n ? first + Arity : n;
+            std::size_t best = first;
+            for (std::size_t c = first + 1; c < last; ++c)
+                if (less(heap[c], heap[best])) best = c;
+            if (!less(heap[best], id)) break;
+            place(i, heap[best]);
+            i = best;
+        }
+        place(i, id);
+    }
+
+    void removeAt(std::size_t i) {
+        std::uint32_t id = heap[i];
+        pos[id] = npos;
+        std::uint32_t last = heap.back();
+        heap.pop_back();
+        if (i < heap.size()) {
+            place(i, last);
+            siftUp(i);
+            siftDown(pos[last]);
+        }
+    }
+};
\ No newline at end of file
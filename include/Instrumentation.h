@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+// Build with -DINSTRUMENTATION_ENABLED=1 to collect per-phase cycle counts
+// and run counters. Off by default: the INSTRUMENT_* macros then expand to
+// nothing and the simulator's hot path is unchanged.
+#ifndef INSTRUMENTATION_ENABLED
+#define INSTRUMENTATION_ENABLED 0
+#endif
+
+// Where a run spends its time. Scheduler calls are timed around the virtual
+// call made by the simulator; Aging runs inside Schedule and is counted in
+// both.
+enum class Phase : std::uint8_t {
+    Admission,      // moving arrivals into the job table, not counting their enqueue
+    Enqueue,
+    Dequeue,
+    HasJobs,
+    Schedule,
+    TimeSlice,
+    Bookkeeping,    // Gantt chart, event log and job table updates
+    Aging,          // PriorityScheduler's aging pass
+    Count
+};
+
+struct RunCounters {
+    static constexpr std::size_t kPhases = (std::size_t)Phase::Count;
+
+    std::uint64_t cycles[kPhases] = {};
+    std::uint64_t calls[kPhases] = {};
+    std::uint64_t dispatches = 0;
+    std::uint64_t contextSwitches = 0;  // dispatches of a different job than the last one
+    std::uint64_t preemptions = 0;      // requeued jobs another job took the CPU from
+    std::uint64_t idleJumps = 0;        // empty queue, clock moved to the next arrival
+    std::uint64_t arrivals = 0;
+    std::uint64_t completions = 0;
+    // Jobs handed to the scheduler and not taken out again. Jobs turned away
+    // by admission control stay counted until the queue next drains.
+    std::uint64_t queueLength = 0;
+    std::uint64_t queueHighWater = 0;
+    std::uint64_t allocations = 0;      // through the run's memory resource
+    std::uint64_t allocatedBytes = 0;
+
+    void reset() { *this = RunCounters(); }
+};
+
+// Time stamp counter where there is one, nanoseconds otherwise
+inline std::uint64_t readCycles() {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    std::uint64_t ticks;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return (std::uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+// Adds the cycles spent in its scope to one phase
+class ScopedTimer {
+public:
+    ScopedTimer(RunCounters& counters, Phase phase) : counters(counters), phase(phase), begin(readCycles()) {}
+    ~ScopedTimer() {
+        counters.cycles[(std::size_t)phase] += readCycles() - begin;
+        ++counters.calls[(std::size_t)phase];
+    }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    RunCounters& counters;
+    Phase phase;
+    std::uint64_t begin;
+};
+
+// Counts allocations passed through to another resource
+class CountingResource : public std::pmr::memory_resource {
+public:
+    CountingResource(std::pmr::memory_resource* upstream, RunCounters& counters)
+        : upstream(upstream), counters(counters) {}
+
+private:
+    std::pmr::memory_resource* upstream;
+    RunCounters& counters;
+
+    void* do_allocate(std::size_t size, std::size_t align) override {
+        ++counters.allocations;
+        counters.allocatedBytes += size;
+        return upstream->allocate(size, align);
+    }
+    void do_deallocate(void* p, std::size_t size, std::size_t align) override { upstream->deallocate(p, size, align); }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+#define INSTRUMENT_CONCAT2(a, b) a##b
+#define INSTRUMENT_CONCAT(a, b) INSTRUMENT_CONCAT2(a, b)
+#if INSTRUMENTATION_ENABLED
+#define INSTRUMENT_SCOPE(counters, phase) ScopedTimer INSTRUMENT_CONCAT(instrumentScope, __LINE__)((counters), (phase))
+#define INSTRUMENT(statement) do { statement; } while (0)
+#else
+#define INSTRUMENT_SCOPE(counters, phase) ((void)0)
+#define INSTRUMENT(statement) ((void)0)
+#endif
+
+class Instrumentation {
+public:
+    static constexpr bool kEnabled = INSTRUMENTATION_ENABLED != 0;
+
+    static const char* phaseName(Phase phase);
+    // Table for the Statistics menu
+    static std::string format(const RunCounters& counters);
+    // One JSON object with every counter, for scripts and dashboards
+    static std::string toJson(const RunCounters& counters);
+};
\ No newline at end of file
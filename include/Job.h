@@ -1,6 +1,10 @@
 #pragma once
 
 #include <iostream>
+#include <string>
+
+// Job::deadline value for jobs without one
+constexpr int kNoDeadline = -1;
 
 class Job {
 public:
@@ -9,27 +13,38 @@ public:
     int arrivalTime;
     int burstTime;
     int priority;
+    int deadline;           // absolute time the job should finish by, or kNoDeadline
     int remainingTime;
     int startTime;
     int completionTime;
     int waitingTime;
     int turnaroundTime;
 
-    Job(int id, int arrival, int burst, int prio = 0);
-    Job(const std::string& name, int arrival, int burst, int prio = 0);
+    Job() : Job(-1, 0, 0, 0) {}
+    Job(int id, int arrival, int burst, int prio = 0, int deadline = kNoDeadline);
+    Job(const std::string& name, int arrival, int burst, int prio = 0, int deadline = kNoDeadline);
 
     // Getters
     std::string getName() const { return name; }
     int getArrivalTime() const { return arrivalTime; }
     int getBurstTime() const { return burstTime; }
     int getPriority() const { return priority; }
+    int getDeadline() const { return deadline; }
+    bool hasDeadline() const { return deadline != kNoDeadline; }
 
     // Setters
     void setArrivalTime(int arrival) { arrivalTime = arrival; }
     void setBurstTime(int burst) { burstTime = burst; }
     void setPriority(int prio) { priority = prio; }
+    void setDeadline(int d) { deadline = d; }
     void setName(const std::string& n) { name = n; }
 
     void calculateMetrics();
     void display() const;
+
+    // One CSV line, `id,name,arrival,burst,priority[,deadline]`, as used by
+    // session files; the deadline is written only when there is one
+    std::string serialize() const;
+    // Inverse of serialize(); returns false and leaves the job untouched on a malformed line
+    bool deserialize(const std::string& line);
 };
\ No newline at end of file
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "Job.h"
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+// Compact reference to a job stored in a JobTable
+using JobHandle = std::uint32_t;
+constexpr JobHandle kNoJob = 0xFFFFFFFFu;
+
+// Sums over every finished job in a table
+struct MetricTotals {
+    long long count = 0;
+    long long waiting = 0;
+    long long turnaround = 0;
+    long long burst = 0;
+};
+
+// Central store for the jobs of one simulation. Ready queues, the Gantt chart
+// and the finished list hold handles into it, so jobs are copied once on
+// admission instead of on every dispatch.
+//
+// Fields are stored column by column (structure of arrays) with names in a
+// separate pool, so metric passes stream through contiguous int32 arrays
+// instead of dragging strings and unused fields through the cache.
+//
+// The columns draw from a memory resource: the default heap unless the
+// table was built for a run arena. Copies without a resource go to the
+// default heap, so a checkpoint can outlive the run it was taken from.
+class JobTable {
+public:
+    JobTable() = default;
+    explicit JobTable(std::pmr::memory_resource* memory);
+    JobTable(const JobTable& other, std::pmr::memory_resource* memory) : JobTable(other, other.size(), memory) {}
+    // Copy of the first n jobs
+    JobTable(const JobTable& other, std::size_t n, std::pmr::memory_resource* memory);
+    JobTable(const JobTable& other) : JobTable(other, std::pmr::get_default_resource()) {}
+    JobTable(JobTable&&) = default;
+    // Takes the columns over when they already come from `memory`
+    JobTable(JobTable&& other, std::pmr::memory_resource* memory);
+    JobTable& operator=(const JobTable&) = default;
+    JobTable& operator=(JobTable&&) = default;
+
+    JobHandle add(const Job& job);
+    // Fresh, not yet scheduled job; lets loaders skip building a Job first
+    JobHandle add(int id, std::string_view name, int arrival, int burst, int priority, int deadline = kNoDeadline);
+    // Overwrites a retired job's row with a fresh one, so a streaming run's
+    // table stays as large as the number of jobs in flight. The row keeps
+    // its name, so tables that recycle rows hold unnamed jobs only.
+    void reuse(JobHandle h, int id, int arrival, int burst, int priority, int deadline = kNoDeadline);
+    void clear();
+    void reserve(std::size_t n);
+    std::size_t size() const { return ids.size(); }
+
+    int id(JobHandle h) const { return ids[h]; }
+    std::string_view name(JobHandle h) const {
+        return std::string_view(namePool.data() + nameOffsets[h], nameOffsets[h + 1] - nameOffsets[h]);
+    }
+    int arrival(JobHandle h) const { return arrivals[h]; }
+    int burst(JobHandle h) const { return bursts[h]; }
+    int priority(JobHandle h) const { return priorities[h]; }
+    int deadline(JobHandle h) const { return deadlines[h]; }
+    bool hasDeadline(JobHandle h) const { return deadlines[h] != kNoDeadline; }
+    int remaining(JobHandle h) const { return remainings[h]; }
+    int start(JobHandle h) const { return starts[h]; }
+    int completion(JobHandle h) const { return completions[h]; }
+    bool finished(JobHandle h) const { return completions[h] >= 0; }
+    int turnaround(JobHandle h) const { return completions[h] - arrivals[h]; }
+    int waiting(JobHandle h) const { return completions[h] - arrivals[h] - bursts[h]; }
+    // Completion - deadline; negative when the job finished early
+    int lateness(JobHandle h) const { return completions[h] - deadlines[h]; }
+
+    void setRemaining(JobHandle h, int remaining) { remainings[h] = remaining; }
+    void setStart(JobHandle h, int start) { starts[h] = start; }
+    // Waiting and turnaround time are derived from completion on demand
+    void complete(JobHandle h, int completion) { completions[h] = completion; }
+
+    // Waiting, turnaround and burst totals over finished jobs, in one pass
+    MetricTotals finishedTotals() const;
+
+    // Full copy, for the Job-based compatibility interface and reporting
+    Job toJob(JobHandle h) const;
+
+    // Bulk append of n fresh or finished jobs from column arrays, e.g. a
+    // mapped trace file. Null start/completion/remaining columns mean the
+    // jobs have not run yet; a null deadline column means none have deadlines. names[nameOffsets[i], nameOffsets[i + 1]) is the
+    // name of job i; offsets are relative to `names`.
+    void appendColumns(std::size_t n, const std::int32_t* ids, const std::int32_t* arrivals,
+                       const std::int32_t* bursts, const std::int32_t* priorities,
+                       const std::int32_t* deadlines, const std::int32_t* remainings, const std::int32_t* starts,
+                       const std::int32_t* completions,
+                       const char* names, const std::uint64_t* nameOffsets);
+
+    // Appends other's jobs from handle `from` on, results included
+    void append(const JobTable& other, std::size_t from);
+
+    // Raw columns for tight loops over the whole table
+    const std::int32_t* idColumn() const { return ids.data(); }
+    const std::int32_t* arrivalColumn() const { return arrivals.data(); }
+    const std::int32_t* burstColumn() const { return bursts.data(); }
+    const std::int32_t* startColumn() const { return starts.data(); }
+    const std::int32_t* completionColumn() const { return completions.data(); }
+    const std::int32_t* priorityColumn() const { return priorities.data(); }
+    const std::int32_t* deadlineColumn() const { return deadlines.data(); }
+    const std::int32_t* remainingColumn() const { return remainings.data(); }
+    const std::pmr::vector<char>& namePoolData() const { return namePool; }
+    const std::pmr::vector<std::size_t>& nameOffsetColumn() const { return nameOffsets; }
+    std::pmr::memory_resource* resource() const { return ids.get_allocator().resource(); }
+
+private:
+    std::pmr::vector<std::int32_t> ids;
+    std::pmr::vector<std::int32_t> arrivals;
+    std::pmr::vector<std::int32_t> bursts;
+    std::pmr::vector<std::int32_t> priorities;
+    std::pmr::vector<std::int32_t> deadlines;
+    std::pmr::vector<std::int32_t> remainings;
+    std::pmr::vector<std::int32_t> starts;
+    std::pmr::vector<std::int32_t> completions;
+    std::pmr::vector<char> namePool;
+    std::pmr::vector<std::size_t> nameOffsets = { 0 };   // name h is [offsets[h], offsets[h + 1])
+};
\ No newline at end of file
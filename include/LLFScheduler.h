@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Scheduler.h"
+#include "IndexedHeap.h"
+#include "DeadlineAdmission.h"
+#include <cstdint>
+#include <vector>
+
+// Least laxity first: the job with the least slack (deadline - now -
+// remaining work) runs. Every waiting job loses slack at the same rate, so
+// queued jobs keep their relative order and sit in a heap keyed by
+// deadline - remaining; only the running job's slack holds still, and its
+// slice ends just as the best waiting job overtakes it, or draws level
+// if it wins the arrival/handle tie-break. Jobs without a deadline come
+// last, in arrival order.
+//
+// Admission control uses the same deadline-order test as EDFScheduler;
+// EDF is optimal on one CPU, so a job it rejects could only meet its
+// deadline by making another job miss.
+class LLFScheduler : public Scheduler {
+public:
+    explicit LLFScheduler(bool admissionControl = false);
+    void enqueue(JobHandle job) override;
+    JobHandle dequeue() override;
+    bool hasJobs() const override;
+    void schedule(int currentTime) override;
+    void setJobs(const std::vector<Job>& jobs) override;
+    void attach(JobTable& jobs) override;
+    std::string getGanttChart() const override;
+    std::string getTimelineLog() const override;
+    std::string getStatistics() const override;
+    int timeSlice(JobHandle job, int currentTime) const override;
+    bool preemptsOnArrival() const override { return true; }
+    std::vector<JobHandle> queuedJobs() const override;
+    // As with EDF, admission runs report their rejections and are not cached
+    std::string configKey() const override { return admissionControl ? "" : "LLF"; }
+    void recycle(JobHandle job) override;
+    void takeRejected(std::vector<JobHandle>& into) override;
+    ~LLFScheduler() override;
+
+    const std::pmr::vector<JobHandle>& rejectedJobs() const { return rejected; }
+
+private:
+    struct LessLaxity {
+        const LLFScheduler* owner;
+        bool operator()(JobHandle a, JobHandle b) const;
+    };
+    IndexedHeap<LessLaxity> readyQueue;
+    std::pmr::vector<std::int64_t> slackKeys;  // per handle: deadline - remaining, set on enqueue
+    std::pmr::vector<char> admitted;
+    std::pmr::vector<JobHandle> rejected;
+    bool admissionControl;
+    std::int64_t slackKey(JobHandle job) const;
+};
\ No newline at end of file
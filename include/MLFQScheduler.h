@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Scheduler.h"
+#include "HandleQueue.h"
+#include <cstdint>
+#include <vector>
+
+// Multilevel feedback queue. New jobs enter level 0, the highest; a job that
+// has used up its level's quantum drops a level, and every boostInterval
+// time units all jobs go back to level 0. Levels are FIFOs, and a bitmap of
+// the non-empty ones finds the next level with one find-first-set, so
+// dispatch cost does not depend on the number of levels.
+class MLFQScheduler : public Scheduler {
+public:
+    static constexpr int kMaxLevels = 64;
+
+    // Quanta per level, highest first; missing entries double the one before
+    // (default 2, 4, 8, ...). boostInterval 0 disables the boost.
+    explicit MLFQScheduler(int levels = 3, std::vector<int> quanta = {}, int boostInterval = 50);
+    void enqueue(JobHandle job) override;
+    JobHandle dequeue() override;
+    bool hasJobs() const override;
+    void schedule(int currentTime) override;
+    void setJobs(const std::vector<Job>& jobs) override;
+    void attach(JobTable& jobs) override;
+    std::string getGanttChart() const override;
+    std::string getTimelineLog() const override;
+    std::string getStatistics() const override;
+    int timeSlice(JobHandle job, int currentTime) const override;
+    // Arrivals enter the top level, so they can take the CPU from a lower one
+    bool preemptsOnArrival() const override { return true; }
+    std::vector<JobHandle> queuedJobs() const override;
+    std::string configKey() const override;
+    void recycle(JobHandle job) override;
+    ~MLFQScheduler() override;
+
+    int levelOf(JobHandle job) const { return job < level.size() ? level[job] : 0; }
+
+private:
+    std::vector<HandleQueue> queues;
+    std::uint64_t nonEmpty;                 // bit L set while level L has jobs
+    std::vector<int> quanta;
+    int boostInterval;
+    int nextBoost;
+    int boostEpoch;                         // boosts so far
+    std::pmr::vector<int> level;                 // per handle
+    std::pmr::vector<int> used;                  // time used at the current level
+    std::pmr::vector<int> dispatchedRemaining;   // remaining time when dispatched, -1 while queued
+    std::pmr::vector<int> dispatchedEpoch;
+    void push(JobHandle job, int lvl, bool front);
+    void boost();
+};
\ No newline at end of file
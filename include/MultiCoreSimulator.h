@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Scheduler.h"
+#include "ArrivalSource.h"
+#include "JobTable.h"
+#include "GanttChart.h"
+#include "Statistics.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+enum class CoreQueueMode {
+    Global,       // one ready queue that every core dispatches from
+    Partitioned   // one queue per core; arrivals go to the least loaded core
+};
+
+struct MultiCoreConfig {
+    int cores = 4;
+    CoreQueueMode mode = CoreQueueMode::Global;
+    // Partitioned only: a core whose queue runs dry takes the next job from
+    // the longest other queue
+    bool workStealing = true;
+    // Time a core spends before a job last run on another core makes progress
+    int migrationCost = 0;
+};
+
+struct CoreStats {
+    long long busy = 0;          // time spent running jobs
+    long long migrationTime = 0; // time lost to migration cost
+    long long dispatches = 0;
+    long long migrations = 0;
+    long long steals = 0;
+    double utilization = 0;      // busy / makespan
+};
+
+// N-processor counterpart of Simulator. Non-preemptive policies (FCFS, RR)
+// keep a core until their slice ends. Preemptive ones (SJF, Priority) are
+// re-decided whenever their queue changes: on every core at every event with
+// a global queue, and on a core whose own queue took an arrival when
+// partitioned. With one core the schedule matches Simulator's.
+class MultiCoreSimulator {
+public:
+    using SchedulerFactory = std::function<std::unique_ptr<Scheduler>()>;
+
+    // Partitioned mode builds one scheduler per core, global mode just one
+    MultiCoreSimulator(SchedulerFactory create, std::vector<Job> jobs, const MultiCoreConfig& config);
+    MultiCoreSimulator(SchedulerFactory create, std::unique_ptr<ArrivalSource> arrivals,
+                       const MultiCoreConfig& config);
+    void run();
+
+    int coreCount() const { return (int)cores.size(); }
+    const JobTable& getJobTable() const { return jobs; }
+    // Gantt lane of one core; migration time shows up as idle
+    const GanttChart& lane(int core) const { return cores[core].lane; }
+    const CoreStats& coreStats(int core) const { return cores[core].stats; }
+    // Per-job statistics; CPU utilization is averaged over all cores
+    RunStatistics statistics() const;
+    // Every core's Gantt lane, the per-core table and the run summary
+    std::string report() const;
+
+private:
+    struct Core {
+        std::unique_ptr<Scheduler> scheduler;   // partitioned only
+        long long queued = 0;                   // jobs waiting in this core's queue
+        bool arrived = false;                   // partitioned: queue gained an arrival since dispatch
+        JobHandle job = kNoJob;
+        int runFrom = 0;                        // dispatch time plus any migration cost
+        int end = 0;
+        GanttChart lane;
+        CoreStats stats;
+    };
+
+    MultiCoreConfig config;
+    std::unique_ptr<Scheduler> global;          // global mode only
+    std::vector<Core> cores;
+    std::unique_ptr<ArrivalSource> arrivals;
+    JobTable jobs;
+    std::vector<int> lastCore;                  // per handle, -1 before its first dispatch
+    int currentTime = 0;
+
+    Scheduler& queueOf(int core) { return global ? *global : *cores[core].scheduler; }
+    void enqueue(int core, JobHandle job);
+    void admitArrivals(int upTo);
+    void stop(int core, int now);
+    void dispatch(int now);
+    void start(int core, JobHandle job, int now);
+    bool anyQueued() const;
+};
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+// Text assembled in one preallocated block instead of through a stream.
+// Unbound, it only grows and str() / take() are the result. Bound to a file,
+// it hands what it holds to the file each time it passes `limit` bytes, so
+// very large outputs go out in a few big writes at bounded memory.
+class OutputBuffer {
+public:
+    explicit OutputBuffer(std::size_t reserve = 1 << 16);
+    explicit OutputBuffer(std::FILE* file, std::size_t limit = 1 << 20);
+    OutputBuffer(const OutputBuffer&) = delete;
+    OutputBuffer& operator=(const OutputBuffer&) = delete;
+    // A bound buffer writes out what is still pending
+    ~OutputBuffer();
+
+    void append(std::string_view s) { text.append(s); spill(); }
+    void append(char c) { text.push_back(c); spill(); }
+    void repeat(char c, std::size_t n) { text.append(n, c); spill(); }
+    void appendInt(long long value);
+    // As std::left / std::right << std::setw(width): padded with spaces,
+    // never cut
+    void appendLeft(std::string_view s, std::size_t width);
+    void appendRight(std::string_view s, std::size_t width);
+    void appendIntLeft(long long value, std::size_t width);
+    void appendIntRight(long long value, std::size_t width);
+
+    std::size_t size() const { return text.size(); }
+    const std::string& str() const { return text; }
+    std::string take();
+
+    // Bound: writes out what is pending. False once any write has failed.
+    bool flush();
+    bool ok() const { return good; }
+    // Everything pending to standard output in a single write(2) where the
+    // platform has one, after flushing what iostream and stdio hold; empties
+    // the buffer
+    bool writeToStdout();
+
+private:
+    std::string text;
+    std::FILE* file = nullptr;
+    std::size_t limit = 0;
+    bool good = true;
+
+    void spill() {
+        if (file && text.size() >= limit) flush();
+    }
+};
\ No newline at end of file
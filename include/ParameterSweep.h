@@ -0,0 +1,83 @@
+#pragma once
+
+#include "ArrivalSource.h"
+#include "Statistics.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Knob values to try. Round Robin runs once per quantum, Priority once per
+// (threshold, increment) pair; an empty list skips that family.
+struct SweepGrid {
+    std::vector<int> rrQuanta;
+    std::vector<int> agingThresholds;
+    std::vector<int> agingIncrements;
+
+    // from, from + step, ... up to and including to
+    static std::vector<int> range(int from, int to, int step = 1);
+};
+
+// What the ranking (and pruning) optimises; lower is better for all of them
+enum class SweepMetric { AvgWaiting, P95Waiting, P99Waiting, AvgTurnaround, P99Turnaround };
+
+struct SweepPoint;
+
+struct SweepOptions {
+    SweepMetric target = SweepMetric::P99Waiting;
+    // Resume looser configs from a checkpoint of the strictest one instead of
+    // replaying the history they provably share
+    bool sharePrefixes = true;
+    // Abandon a config once a lower bound on its target exceeds the best
+    // finished result
+    bool pruneDominated = true;
+    // Rank by statistics from quantile sketches fed during each run rather
+    // than an exact pass over its job table; percentiles are then within the
+    // sketches' relative accuracy (see QuantileSketch.h). Resumed configs
+    // pick up the sketches of the prefix they share.
+    bool sketches = false;
+    // Set from another thread to stop early: points not finished by then
+    // come back marked cancelled
+    const std::atomic<bool>* cancel = nullptr;
+    // Called from the worker threads as each point is settled, in whatever
+    // order they finish; must be thread-safe
+    std::function<void(const SweepPoint&)> onPoint;
+    unsigned threads = 0;           // 0 = one per hardware thread
+    long long checkInterval = 0;    // dispatches between checkpoints / bound checks; 0 = auto
+};
+
+struct SweepPoint {
+    std::string family;             // "RR" or "Priority"
+    int quantum = 0;
+    int agingThreshold = 0;
+    int agingIncrement = 0;
+    std::string label;
+    RunStatistics stats;            // only meaningful when !pruned && !cancelled
+    bool pruned = false;
+    bool cancelled = false;         // the sweep was cancelled before this point finished
+    double bound = 0;               // pruned: lower bound on the target when abandoned
+    long long sharedUpTo = -1;      // time the run resumed from, -1 when simulated from 0
+    bool reused = false;            // whole run shared with the family's strictest config
+    double wallMs = 0;
+};
+
+// Runs every point of a grid against one job set, fanning configurations out
+// over a thread pool. Within a family, the strictest setting (smallest
+// quantum, earliest aging threshold) runs first and leaves checkpoints up to
+// the point where its schedule could start to differ from a looser one; the
+// others resume from the latest such checkpoint.
+class ParameterSweep {
+public:
+    // Points come back in grid order: the RR quanta, then thresholds x increments
+    static std::vector<SweepPoint> run(std::shared_ptr<const SharedJobSet> jobs, const SweepGrid& grid,
+                                       const SweepOptions& options = SweepOptions());
+
+    static double metricValue(const RunStatistics& stats, SweepMetric metric);
+    static const char* metricName(SweepMetric metric);
+
+    // Finished points best first, pruned and cancelled ones after them
+    static std::string formatRanking(const std::vector<SweepPoint>& points, SweepMetric metric);
+    static bool writeCsv(const std::string& path, const std::vector<SweepPoint>& points,
+                         SweepMetric metric, std::string& error);
+};
\ No newline at end of file
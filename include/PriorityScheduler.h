@@ -1,27 +1,67 @@
 #pragma once
 
 #include "Scheduler.h"
+#include "IndexedHeap.h"
 #include <vector>
 #include <algorithm>
 
-class PriorityScheduler : public Scheduler {
+// Final so the simulator's Priority loop calls it directly
+class PriorityScheduler final : public Scheduler {
 public:
-    PriorityScheduler(int agingThreshold = 5, int agingIncrement = 1);
-    void addJob(const Job& job) override;
-    Job getNextJob() override;
+    // Lazy aging keeps every job's submitted priority and derives the aged one
+    // from its arrival time on demand; eager aging rewrites queued priorities
+    // on every decision. Both produce the same schedule.
+    PriorityScheduler(int agingThreshold = 5, int agingIncrement = 1, bool lazyAging = true);
+    void enqueue(JobHandle job) override;
+    JobHandle dequeue() override;
     bool hasJobs() const override;
     void schedule(int currentTime) override;
     void setJobs(const std::vector<Job>& jobs) override;
+    void attach(JobTable& jobs) override;
     std::string getGanttChart() const override;
     std::string getTimelineLog() const override;
     std::string getStatistics() const override;
+    int timeSlice(JobHandle job, int currentTime) const override;
+    std::vector<JobHandle> queuedJobs() const override;
+    // Eager aging keeps aged priorities the table does not have
+    bool resumesFromQueue() const override { return lazyAging || agingIncrement == 0; }
+    int sharedPrefixHorizon() const override { return sharedHorizon; }
+    std::string configKey() const override;
+    bool preemptsOnArrival() const override { return true; }
+    void recycle(JobHandle job) override;
     ~PriorityScheduler() override;
 
 private:
-    std::vector<Job> priorityQueue;
-    std::vector<Job> scheduledJobs;
-    std::vector<std::string> timelineLog;
+    // Heap orders over handles into the attached table
+    struct HigherPriority {
+        const PriorityScheduler* owner;
+        bool operator()(JobHandle a, JobHandle b) const;
+    };
+    struct EarlierAgingKey {
+        const PriorityScheduler* owner;
+        bool operator()(JobHandle a, JobHandle b) const;
+    };
+    struct EarlierArrival {
+        const PriorityScheduler* owner;
+        bool operator()(JobHandle a, JobHandle b) const;
+    };
+    std::pmr::vector<int> priorities;              // eager: aged priority per handle
+    std::pmr::vector<long long> agingKeys;         // lazy: priority + increment * (arrival + threshold)
+    IndexedHeap<HigherPriority> priorityQueue;     // eager: every job; lazy: jobs not aging yet
+    IndexedHeap<EarlierAgingKey> agingQueue;       // lazy: aging jobs, priority = key - increment * time
+    IndexedHeap<EarlierArrival> clampedQueue;      // lazy: jobs aged all the way down to 0
+    IndexedHeap<EarlierArrival> agingStarts;       // lazy: jobs not aging yet, by when they start
     int agingThreshold;
     int agingIncrement;
+    bool lazyAging;
+    int lastAgingTime;
+    mutable int sharedHorizon;                     // earliest aging start any slice decision looked past
+    long long agingFrom(JobHandle job) const;
+    int currentPriority(JobHandle job) const;
     void applyAging(int currentTime);
+    void place(JobHandle job);
+    void settle(int currentTime);
+    JobHandle bestJob() const;
+    long long agedPriority(JobHandle job, long long agedUpTo, long long at) const;
+    long long overtakeTime(JobHandle challenger, JobHandle running, long long agedUpTo, long long from, long long to) const;
 };
\ No newline at end of file
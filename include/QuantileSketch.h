@@ -0,0 +1,102 @@
+#pragma once
+
+#include "JobTable.h"
+#include "Statistics.h"
+#include "WireFormat.h"
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// Relative-error quantile sketch over integer samples (DDSketch). A value v
+// lands in bucket ceil(log_gamma |v|) with gamma = (1 + a) / (1 - a), so any
+// quantile it reports is within a relative `a` of the exact nearest-rank one;
+// zero has a bucket of its own and negative values a mirrored store. Count,
+// min, max, sum and sum of squares are kept exactly.
+//
+// Memory depends on the range of the samples, not on their number: about
+// ln(max) / (2a) buckets, a little over a thousand for the whole int32 range
+// at the default 1%. Two sketches with the same accuracy merge by adding
+// bucket counts, so per-worker or per-window sketches combine into exactly
+// the sketch of all their samples.
+class QuantileSketch {
+public:
+    static constexpr double kDefaultAccuracy = 0.01;
+
+    explicit QuantileSketch(double relativeAccuracy = kDefaultAccuracy);
+
+    void add(std::int32_t value);
+    // False, leaving this sketch as it was, when the accuracies differ
+    bool merge(const QuantileSketch& other);
+    void clear();
+
+    double accuracy() const { return alpha; }
+    long long count() const { return n; }
+    bool empty() const { return n == 0; }
+    std::int32_t min() const { return n ? lo : 0; }
+    std::int32_t max() const { return n ? hi : 0; }
+    long long sum() const { return total; }
+    double mean() const { return n ? (double)total / n : 0; }
+    double variance() const;
+    // Nearest-rank q-quantile, 0 <= q <= 1, as StatisticsEngine::describe
+    // ranks them; 0 when empty
+    std::int32_t quantile(double q) const;
+    // The same fields describe() fills, percentiles estimated
+    Distribution summary() const;
+    std::size_t memoryBytes() const;
+
+    // Compact form for shipping between processes: the exact fields plus
+    // the non-zero span of each store as varints. decode() replaces this
+    // sketch and returns false, leaving it as it was, on malformed input.
+    void encode(WireWriter& out) const;
+    bool decode(WireReader& in);
+
+private:
+    double alpha;
+    double gamma;
+    double logGamma;
+    const std::uint16_t* smallKeys;         // keys of small magnitudes, default accuracy only
+    std::vector<std::uint64_t> positive;    // by key, from 0 (the value 1)
+    std::vector<std::uint64_t> negative;    // by the key of -v
+    std::uint64_t zeros = 0;
+    long long n = 0;
+    std::int32_t lo = std::numeric_limits<std::int32_t>::max();
+    std::int32_t hi = std::numeric_limits<std::int32_t>::min();
+    long long total = 0;
+    double sumSquares = 0;
+
+    std::size_t keyOf(std::uint32_t magnitude) const;
+    double valueOf(std::size_t key) const;
+};
+
+// What RunStatistics needs, gathered as jobs finish instead of by a pass
+// over the job table afterwards. Sketches of disjoint sets of jobs on one
+// timeline (stream windows, the two halves of a resumed run) merge() into
+// the sketches of their union. Shards replayed on their own, each from an
+// empty queue, overlap in time instead, so mergeShard() adds up their
+// makespans and throughput and utilization are taken over that total.
+struct RunSketches {
+    QuantileSketch waiting;
+    QuantileSketch turnaround;
+    QuantileSketch response;
+    QuantileSketch lateness;            // finished jobs with a deadline
+    long long totalBurst = 0;
+    long long firstArrival = std::numeric_limits<long long>::max();
+    long long lastCompletion = 0;
+    long long deadlineJobs = 0;         // admitted with a deadline
+    long long deadlineLate = 0;         // finished after it
+    long long shardMakespan = 0;        // summed by mergeShard(); 0 for one timeline
+
+    void admit(const JobTable& jobs, JobHandle job);
+    void finish(const JobTable& jobs, JobHandle job);
+    bool merge(const RunSketches& other);
+    bool mergeShard(const RunSketches& other);
+    long long makespan() const;
+    void encode(WireWriter& out) const;
+    bool decode(WireReader& in);
+    // As StatisticsEngine::compute, with estimated percentiles. Jobs
+    // admitted with a deadline that never finished count as misses.
+    RunStatistics statistics() const;
+
+    // Every job of a finished run's table, e.g. one read from a cache
+    static RunSketches fromTable(const JobTable& jobs);
+};
\ No newline at end of file
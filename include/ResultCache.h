@@ -0,0 +1,86 @@
+#pragma once
+
+#include "ArrivalSource.h"
+#include "GanttChart.h"
+#include "JobTable.h"
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+// A finished run as the cache keeps it: the jobs with their results, in the
+// order the simulator admitted them (arrival order), and the Gantt chart
+struct CachedRun {
+    std::string config;
+    JobTable jobs;
+    GanttChart gantt;
+};
+
+// Finished runs addressed by what they were computed from: a hash of the
+// job set in arrival order plus the scheduler's configKey(). A hit is
+// checked against the job set itself and the full config key, so a hash
+// collision is a miss, never a wrong result.
+//
+// Entries live in memory up to a byte budget, least recently used going
+// first. With a directory set they are also written there as schedule
+// traces, named after both hashes, each with its config key in a
+// `.config` file beside it, and runs from earlier sessions are found again
+// after the memory copy is gone. Safe to use from several threads.
+class ResultCache {
+public:
+    static constexpr std::size_t kDefaultBudget = std::size_t(256) << 20;
+
+    struct Stats {
+        long long hits = 0;         // memory and disk together
+        long long diskHits = 0;
+        long long misses = 0;
+        std::size_t entries = 0;
+        std::size_t bytes = 0;
+    };
+
+    explicit ResultCache(std::size_t memoryBudget = kDefaultBudget);
+
+    // Content hash of a job set: id, name, arrival, burst, priority and
+    // deadline of every job, in the order a simulator admits them
+    static std::uint64_t hashJobs(const SharedJobSet& jobs);
+
+    // Where results are also kept on disk; created on first store. Empty
+    // turns the disk store off.
+    void setDirectory(std::string directory);
+    const std::string& directory() const { return storeDirectory; }
+
+    // The run of `jobs` (whose hashJobs() is `jobsHash`) under `config`, or
+    // null; always null for an empty config
+    std::shared_ptr<const CachedRun> find(const SharedJobSet& jobs, std::uint64_t jobsHash, const std::string& config);
+    // Copies a finished run's table and chart in and returns the entry. A
+    // run larger than the whole budget is only written to disk.
+    std::shared_ptr<const CachedRun> store(std::uint64_t jobsHash, const std::string& config,
+                                           const JobTable& jobs, const GanttChart& gantt);
+    // Forgets the memory entries; the disk store is left alone
+    void clear();
+    Stats stats() const;
+
+private:
+    using Key = std::pair<std::uint64_t, std::string>;
+    struct Entry {
+        std::shared_ptr<const CachedRun> run;
+        std::size_t bytes;
+        std::list<Key>::iterator recent;
+    };
+
+    mutable std::mutex mutex;
+    std::size_t budget;
+    std::size_t used = 0;
+    std::map<Key, Entry> entries;
+    std::list<Key> recency;             // most recently used first
+    std::string storeDirectory;
+    Stats counts;
+
+    void insert(const Key& key, std::shared_ptr<const CachedRun> run);
+    std::string pathFor(std::uint64_t jobsHash, const std::string& config) const;
+    static bool matches(const CachedRun& run, const SharedJobSet& jobs);
+    static std::size_t footprint(const CachedRun& run);
+};
\ No newline at end of file
@@ -1,24 +1,38 @@
 #pragma once
 
 #include "Scheduler.h"
-#include <queue>
+#include "HandleQueue.h"
+#include <algorithm>
 
-class RoundRobinScheduler : public Scheduler {
+// Final, with the per-dispatch calls defined here, so the simulator's
+// Round Robin loop calls them directly and can inline them
+class RoundRobinScheduler final : public Scheduler {
 public:
-    RoundRobinScheduler(int quantum);
-    void addJob(const Job& job) override;
-    Job getNextJob() override;
-    bool hasJobs() const override;
-    void schedule(int currentTime) override;
+    explicit RoundRobinScheduler(int quantum = 2);
+    void enqueue(JobHandle job) override { rrQueue.push_back(job); }
+    JobHandle dequeue() override { return rrQueue.empty() ? kNoJob : rrQueue.pop_front(); }
+    bool hasJobs() const override { return !rrQueue.empty(); }
+    // FIFO order is all Round Robin needs; the quantum is applied per slice
+    void schedule(int currentTime) override {}
     void setJobs(const std::vector<Job>& jobs) override;
+    void attach(JobTable& jobs) override;
     std::string getGanttChart() const override;
     std::string getTimelineLog() const override;
     std::string getStatistics() const override;
+    std::vector<JobHandle> queuedJobs() const override;
+    bool resumesFromQueue() const override { return true; }
+    std::string configKey() const override { return "RR q=" + std::to_string(timeQuantum); }
+    // A whole quantum per dispatch (the simulator stops early if the job
+    // finishes), so a job costs one pop and one push per slice, not per tick
+    int timeSlice(JobHandle job, int currentTime) const override {
+        if (table->remaining(job) > timeQuantum) sharedHorizon = std::min(sharedHorizon, currentTime);
+        return timeQuantum;
+    }
+    int sharedPrefixHorizon() const override;
     ~RoundRobinScheduler() override;
 
 private:
-    std::queue<Job> rrQueue;
-    std::vector<Job> scheduledJobs;
-    std::vector<std::string> timelineLog;
+    HandleQueue rrQueue;
     int timeQuantum;
+    mutable int sharedHorizon;   // first dispatch the quantum cut short
 };
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+// Monotonic arena for the storage of one simulation run: the job table, the
+// Gantt chart and the scheduler's queues. Allocation is a pointer bump with
+// no locking, and everything is dropped at once by release(). The buffer is
+// kept between runs and grows to the largest run seen (up to
+// kMaxRetainedBytes), so a sweep repeating similar runs on a worker thread
+// stops calling the global allocator after the first one.
+//
+// Not thread-safe; each worker thread uses its own (local()).
+class RunArena {
+public:
+    static constexpr std::size_t kMaxRetainedBytes = std::size_t(64) << 20;
+
+    explicit RunArena(std::size_t initialBytes = std::size_t(64) << 10);
+    RunArena(const RunArena&) = delete;
+    RunArena& operator=(const RunArena&) = delete;
+
+    std::pmr::memory_resource* resource() { return arena.get(); }
+    // Frees everything allocated since the last release. Containers using
+    // the arena must be gone by then.
+    void release();
+    std::size_t capacity() const { return buffer.size(); }
+
+    // This thread's arena
+    static RunArena& local();
+
+    // One run on this thread's arena. Scopes nest; the arena is released
+    // when the outermost one ends, so declare it before the Simulator.
+    class Scope {
+    public:
+        Scope();
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        std::pmr::memory_resource* resource() { return owner.resource(); }
+
+    private:
+        RunArena& owner;
+    };
+
+private:
+    // Counts what the arena had to fetch beyond its buffer
+    class Overflow : public std::pmr::memory_resource {
+    public:
+        std::size_t bytes = 0;
+
+    private:
+        void* do_allocate(std::size_t size, std::size_t align) override;
+        void do_deallocate(void* p, std::size_t size, std::size_t align) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+
+    std::vector<std::byte> buffer;
+    Overflow overflow;
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> arena;
+    int depth = 0;
+};
+
+// Forwards to another resource that can be swapped out. Schedulers are built
+// before they know which run they serve, and pmr containers keep the
+// resource they were built with, so their containers allocate through one of
+// these and attach() points it at the run's resource. Only retarget while
+// nothing allocated through it is still alive.
+class ForwardingResource : public std::pmr::memory_resource {
+public:
+    void retarget(std::pmr::memory_resource* to) { target = to ? to : std::pmr::get_default_resource(); }
+    std::pmr::memory_resource* current() const { return target; }
+
+private:
+    std::pmr::memory_resource* target = std::pmr::get_default_resource();
+
+    void* do_allocate(std::size_t size, std::size_t align) override { return target->allocate(size, align); }
+    void do_deallocate(void* p, std::size_t size, std::size_t align) override { target->deallocate(p, size, align); }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
\ No newline at end of file
@@ -1,24 +1,42 @@
 #pragma once
 
 #include "Scheduler.h"
+#include "IndexedHeap.h"
 #include <vector>
 #include <algorithm>
 
-class SJFScheduler : public Scheduler {
+// Final, with the per-dispatch calls and the heap order defined here, so
+// the simulator's SJF loop calls them directly and can inline them
+class SJFScheduler final : public Scheduler {
 public:
     SJFScheduler();
-    void addJob(const Job& job) override;
-    Job getNextJob() override;
-    bool hasJobs() const override;
-    void schedule(int currentTime) override;
+    void enqueue(JobHandle job) override { sjfQueue.push(job); }
+    JobHandle dequeue() override { return sjfQueue.empty() ? kNoJob : sjfQueue.pop(); }
+    bool hasJobs() const override { return !sjfQueue.empty(); }
+    // The heap keeps the ready queue ordered; nothing to re-sort per decision
+    void schedule(int currentTime) override {}
     void setJobs(const std::vector<Job>& jobs) override;
+    void attach(JobTable& jobs) override;
     std::string getGanttChart() const override;
     std::string getTimelineLog() const override;
     std::string getStatistics() const override;
+    std::vector<JobHandle> queuedJobs() const override;
+    bool resumesFromQueue() const override { return true; }
+    std::string configKey() const override { return "SJF"; }
+    bool preemptsOnArrival() const override { return true; }
     ~SJFScheduler() override;
 
 private:
-    std::vector<Job> sjfQueue;
-    std::vector<Job> scheduledJobs;
-    std::vector<std::string> timelineLog;
+    // Orders handles by remaining time in the attached table
+    struct ShorterRemaining {
+        const SJFScheduler* owner;
+        // Shortest remaining time first; ties go to the earlier arrival, then admission order
+        bool operator()(JobHandle a, JobHandle b) const {
+            const JobTable& jobs = *owner->table;
+            if (jobs.remaining(a) != jobs.remaining(b)) return jobs.remaining(a) < jobs.remaining(b);
+            if (jobs.arrival(a) != jobs.arrival(b)) return jobs.arrival(a) < jobs.arrival(b);
+            return a < b;
+        }
+    };
+    IndexedHeap<ShorterRemaining> sjfQueue;
 };
\ No newline at end of file
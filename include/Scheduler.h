@@ -1,20 +1,105 @@
 #pragma once
 
 #include <vector>
+#include <limits>
 #include "Job.h"
+#include "JobTable.h"
+#include "GanttChart.h"
+#include "EventLog.h"
+#include "Instrumentation.h"
+#include "RunArena.h"
 
 class Scheduler {
 public:
-    virtual void addJob(const Job& job) = 0;
-    virtual Job getNextJob() = 0;
+    Scheduler() : table(&ownTable), gantt(&ownGantt), events(&ownEvents), counters(&ownCounters) {}
+
+    // Handle interface driven by Simulator. Handles index the table given to
+    // attach(); queues never copy Job objects.
+    virtual void enqueue(JobHandle job) = 0;
+    virtual JobHandle dequeue() = 0;
     virtual bool hasJobs() const = 0;
     virtual void schedule(int currentTime) = 0;
     virtual void setJobs(const std::vector<Job>& jobs) = 0;
     virtual std::string getGanttChart() const = 0;
     virtual std::string getTimelineLog() const = 0;
     virtual std::string getStatistics() const = 0;
+
+    // Longest stretch the dispatched job may keep the CPU before the policy
+    // has to decide again, assuming nothing else arrives. The simulator jumps
+    // straight to the end of it instead of re-scheduling every time unit.
+    virtual int timeSlice(JobHandle job, int currentTime) const { return table->remaining(job); }
+    // Whether an arrival can take the CPU away from the running job.
+    virtual bool preemptsOnArrival() const { return false; }
+
+    // Handles currently queued, in the order they would be served (or, for
+    // a policy whose order follows from the table alone, some fixed order,
+    // so equal queues list the same). A checkpoint keeps these so a fresh
+    // scheduler can carry the run on.
+    virtual std::vector<JobHandle> queuedJobs() const { return {}; }
+    // Whether that carry-on is exact: a fresh instance given queuedJobs()
+    // over the same table decides everything the same way from then on.
+    // Policies with per-job state of their own (levels, virtual runtimes)
+    // say no, and incremental re-simulation runs them from the start.
+    virtual bool resumesFromQueue() const { return false; }
+    // Time up to which every decision so far would have come out the same
+    // under any looser setting of this policy's knobs (a longer quantum, a
+    // later aging threshold). Sweeps resume such variants from a checkpoint
+    // taken no later than this; INT_MIN means nothing can be shared.
+    virtual int sharedPrefixHorizon() const { return std::numeric_limits<int>::min(); }
+    // Names the policy and every knob that affects its decisions, so a
+    // finished run can be looked up by job set and configuration
+    // (ResultCache). Empty means runs are not reused: the default, so
+    // plugins opt in, and the answer for policies whose reports need more
+    // than the finished table and Gantt chart.
+    virtual std::string configKey() const { return {}; }
+
+    // A streaming run is done with this handle and will hand it to a later
+    // arrival. Policies that keep per-handle state (first-arrival flags,
+    // levels, virtual runtimes) reset it here.
+    virtual void recycle(JobHandle job) {}
+    // Appends the handles turned away at admission since the last call and
+    // forgets them. They will never run, so a streaming run retires them
+    // straight away; batch runs never ask.
+    virtual void takeRejected(std::vector<JobHandle>& into) {}
+
+    // Points the scheduler at the table its handles refer to; the
+    // scheduler's containers allocate from the table's memory resource from
+    // then on. Overrides must drop any queued handles, which belong to the
+    // previous table, and release their containers' storage before calling
+    // this, since that storage came from the previous resource.
+    virtual void attach(JobTable& jobs) {
+        table = &jobs;
+        runResource.retarget(jobs.resource());
+    }
+    // Execution history the simulator records; getGanttChart() renders it
+    void attachGantt(const GanttChart& chart) { gantt = &chart; }
+    // Timeline events the simulator records; getTimelineLog() formats them
+    void attachEvents(const EventLog& log) { events = &log; }
+    // Run counters for INSTRUMENT_SCOPE inside a policy
+    void attachCounters(RunCounters& runCounters) { counters = &runCounters; }
+
+    // Job-value compatibility shim over the handle interface
+    virtual void addJob(const Job& job) { enqueue(table->add(job)); }
+    virtual Job getNextJob() { return hasJobs() ? table->toJob(dequeue()) : Job(-1, 0, 0, 0); }
+
     virtual ~Scheduler() {}
 
 protected:
+    // For the containers of derived schedulers; follows the attached table
+    std::pmr::memory_resource* runMemory() { return &runResource; }
+    template <typename Container>
+    static void releaseStorage(Container& container) { Container(container.get_allocator()).swap(container); }
+
     std::vector<Job> jobQueue;
+    JobTable* table;
+    JobTable ownTable;   // used until a simulator attaches its own
+    const GanttChart* gantt;
+    GanttChart ownGantt;
+    const EventLog* events;
+    EventLog ownEvents;
+    RunCounters* counters;
+    RunCounters ownCounters;
+
+private:
+    ForwardingResource runResource;
 };
\ No newline at end of file
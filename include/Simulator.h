@@ -2,20 +2,152 @@
 
 #include <vector>
 #include <memory>
+#include <memory_resource>
 #include "Scheduler.h"
+#include "ArrivalSource.h"
+#include "JobTable.h"
+#include "GanttChart.h"
+#include "EventLog.h"
+#include "Instrumentation.h"
+#include "QuantileSketch.h"
 #include "Job.h"
 
+// Everything a run needs to carry on from a point in time, independent of
+// the scheduler that produced it
+struct SimulatorCheckpoint {
+    int time = 0;
+    JobTable jobs;                  // admitted so far; its size is the arrival cursor
+    GanttChart gantt;
+    EventLog events;
+    std::vector<JobHandle> finished;
+    std::vector<JobHandle> queued;  // the scheduler's queue in service order
+    JobHandle preempted = kNoJob;   // requeued by the last slice, not yet logged
+    // The run's sketches when it kept them; checkpointAt() leaves them out
+    std::shared_ptr<const RunSketches> sketches;
+};
+
+// A checkpoint by reference into the run it was taken from: how far each
+// column had got, plus the progress of the jobs still queued, which is all
+// that changes in the table afterwards. Costs the queue length rather than
+// the run length, so a run can leave one every few thousand dispatches.
+struct SimulatorMark {
+    int time = 0;
+    std::size_t admitted = 0;       // job table size
+    std::size_t segments = 0;       // Gantt segments, the last one lastSegmentLength long
+    int lastSegmentLength = 0;
+    std::size_t events = 0;
+    std::size_t finished = 0;
+    std::vector<JobHandle> queued;  // as in SimulatorCheckpoint
+    std::vector<int> queuedRemaining;
+    std::vector<int> queuedStart;
+    JobHandle preempted = kNoJob;
+};
+
+// Where a streaming run's jobs go once the run is done with them: finished,
+// or turned away at admission (never finished). The handle is reused for a
+// later arrival after retire() returns.
+class JobRetirement {
+public:
+    virtual void retire(const JobTable& jobs, JobHandle job, int time) = 0;
+    virtual ~JobRetirement() {}
+};
+
+// The job table, finished list, Gantt chart, event log and the scheduler's queues all
+// draw from `memory`. Passing a RunArena's resource makes the run's storage a
+// pointer bump that is dropped in one go; the arena must outlive the
+// simulator. Checkpoints are copied out to the default heap.
 class Simulator {
 public:
-    Simulator(std::unique_ptr<Scheduler> scheduler, std::vector<Job> jobs);
+    Simulator(std::unique_ptr<Scheduler> scheduler, std::vector<Job> jobs,
+              std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+    Simulator(std::unique_ptr<Scheduler> scheduler, std::unique_ptr<ArrivalSource> arrivals,
+              std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+    // Picks up a run over `jobs` where the checkpoint left it
+    Simulator(std::unique_ptr<Scheduler> scheduler, std::shared_ptr<const SharedJobSet> jobs,
+              const SimulatorCheckpoint& from,
+              std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+    // As above, taking the checkpoint's columns over where they already come from `memory`
+    Simulator(std::unique_ptr<Scheduler> scheduler, std::shared_ptr<const SharedJobSet> jobs,
+              SimulatorCheckpoint&& from,
+              std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+    Simulator(const Simulator&) = delete;
+    Simulator& operator=(const Simulator&) = delete;
     void run();
+    // One dispatch (or a jump to the next arrival); false once the run is over
+    bool step();
+    bool done() const { return !arrivals->hasNext() && !scheduler->hasJobs(); }
+    int getCurrentTime() const { return currentTime; }
+    SimulatorCheckpoint checkpoint() const;
+    // Moves the state out instead of copying it; the simulator is spent
+    SimulatorCheckpoint releaseCheckpoint();
+    SimulatorMark mark() const;
+    // Expands a mark taken earlier in this run into the full checkpoint
+    SimulatorCheckpoint checkpointAt(const SimulatorMark& mark) const;
     void reportMetrics() const;
     void printGanttChart() const;
+    const Scheduler& getScheduler() const { return *scheduler; }
+    const JobTable& getJobTable() const { return jobs; }
+    const GanttChart& getGanttChart() const { return ganttChart; }
+    const EventLog& getEventLog() const { return events; }
+    // Handles in the order their jobs completed
+    const std::pmr::vector<JobHandle>& getFinishedJobs() const { return finishedJobs; }
+    // Timeline events are recorded unless switched off here (or at build
+    // time, see EventLog.h); batch runs that only need statistics skip them
+    void setEventLogging(bool enabled) { events.setEnabled(enabled); }
+    // Likewise the Gantt chart
+    void setGanttRecording(bool enabled) { ganttChart.setEnabled(enabled); }
+    // Streaming runs: jobs are handed to `sink` instead of piling up in the
+    // finished list, and the scheduler is told to recycle their handles.
+    // The arrival source is expected to reuse those handles' rows.
+    void setRetirement(JobRetirement* sink) { retirement = sink; }
+    // Quantile sketches of the finished jobs' metrics, fed as each job
+    // completes, for statistics without a pass over the table afterwards.
+    // Off (null) unless switched on before the run; a run resumed from a
+    // checkpoint carries on with the checkpoint's.
+    void setSketching(bool enabled);
+    const RunSketches* getSketches() const { return sketches.get(); }
+    // Phase timings and run counters; all zero unless built with
+    // INSTRUMENTATION_ENABLED (see Instrumentation.h). A resumed run counts
+    // from the checkpoint on.
+    const RunCounters& getCounters() const { return counters; }
 
 private:
     int currentTime;
+    RunCounters counters;
+    CountingResource countedMemory;              // in front of the run's resource when instrumented
     std::unique_ptr<Scheduler> scheduler;
-    std::vector<Job> allJobs;
-    std::vector<Job> finishedJobs;
-    std::vector<std::pair<int, int>> ganttChart; // (jobId, time)
+    std::unique_ptr<ArrivalSource> arrivals;
+    JobTable jobs;                               // every admitted job; the rest hold handles
+    std::pmr::vector<JobHandle> finishedJobs;
+    GanttChart ganttChart;
+    EventLog events;
+    // Job the last slice put back in the queue. Its preemption is logged
+    // only once something else is dispatched, so a slice boundary where the
+    // same job carries on leaves no trace.
+    JobHandle preempted;
+    JobHandle lastDispatched;
+    JobRetirement* retirement = nullptr;
+    std::vector<JobHandle> turnedAway;
+    std::unique_ptr<RunSketches> sketches;
+    // The step loop, instantiated per built-in policy (FCFS, SJF, RR,
+    // Priority) so its scheduler calls are direct and can inline; any other
+    // scheduler, plugins included, goes through the virtual interface.
+    // Picked once when the scheduler is attached.
+    using Loop = bool (*)(Simulator& sim, bool once);
+    Loop loop;
+    static Loop loopFor(Scheduler& scheduler);
+    template <typename Policy> static bool runLoop(Simulator& sim, bool once);
+    template <typename Policy> bool stepWith(Policy& policy);
+
+    std::pmr::memory_resource* runMemory(std::pmr::memory_resource* memory) {
+        return Instrumentation::kEnabled ? &countedMemory : memory;
+    }
+    void attachScheduler();
+    void countDispatch(JobHandle job);
+    void countQueued();
+    void retire(JobHandle job);
+    void retireRejected();
+
+    template <typename Policy> void admitArrivals(Policy& policy, int upTo);
+    int nextArrivalTime();
 };
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "JobTable.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Summary of one per-job metric over the finished jobs of a run
+struct Distribution {
+    long long count = 0;
+    int min = 0;
+    int max = 0;
+    double mean = 0;
+    double variance = 0;
+    int p50 = 0;
+    int p95 = 0;
+    int p99 = 0;
+};
+
+struct RunStatistics {
+    long long jobs = 0;
+    Distribution waiting;
+    Distribution turnaround;
+    Distribution response;      // first dispatch - arrival
+    long long totalBurst = 0;
+    long long makespan = 0;     // first arrival (or 0) to last completion
+    double throughput = 0;      // finished jobs per time unit
+    double cpuUtilization = 0;  // busy time / makespan
+
+    // Jobs with a deadline. A job that never finished (rejected at
+    // admission, or the run was cut short) counts as a miss.
+    long long deadlineJobs = 0;
+    long long deadlineMisses = 0;
+    long long deadlineUnfinished = 0;
+    double deadlineMissRate = 0;
+    Distribution lateness;      // completion - deadline, finished jobs with a deadline
+};
+
+// Statistics shared by every scheduler and the simulator. Moments are reduced
+// with AVX2 or NEON when the build enables them, with a scalar fallback;
+// percentiles use selection rather than a full sort.
+class StatisticsEngine {
+public:
+    static RunStatistics compute(const JobTable& jobs);
+    // Moments and percentiles of any sample; may reorder `values`
+    static Distribution describe(std::vector<std::int32_t>& values);
+    // Min / max / mean / stddev / p50 / p95 / p99 block plus throughput and
+    // utilization, and the deadline miss rate when any job has a deadline
+    static std::string formatSummary(const RunStatistics& stats);
+    // Per-job WT/TT table followed by the summary, as the Statistics menu shows it
+    static std::string report(const JobTable& jobs, const std::string& algorithm);
+    // Which moment kernel this build uses: "AVX2", "NEON" or "scalar"
+    static const char* kernelName();
+};
\ No newline at end of file
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "Simulator.h"
+#include "Statistics.h"
+#include "QuantileSketch.h"
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// A job fed to a streaming run. Streamed jobs carry no name; an id is all
+// the windowed metrics need.
+struct StreamJob {
+    int id = 0;
+    int arrival = 0;
+    int burst = 0;
+    int priority = 0;
+    int deadline = kNoDeadline;
+};
+
+// Bounded queue between a producer (a pipe or socket reader) and a
+// streaming run. push() blocks while the queue is full, so a producer that
+// outpaces the simulator is held to its pace instead of growing the queue.
+// Jobs should come in non-decreasing arrival order; a late one is admitted
+// at the next admission point, as with GeneratorArrivalSource.
+class JobStream {
+public:
+    explicit JobStream(std::size_t capacity = 4096);
+    JobStream(const JobStream&) = delete;
+    JobStream& operator=(const JobStream&) = delete;
+
+    // False once the stream is closed
+    bool push(const StreamJob& job);
+    // Never blocks; false when the queue is full or closed
+    bool tryPush(const StreamJob& job);
+    // No more jobs; the run drains what is queued and ends
+    void close();
+
+    // Consumer side: moves up to `max` jobs into `into`, waiting while the
+    // queue is empty and open. Returns 0 only once closed and drained.
+    std::size_t popBatch(std::vector<StreamJob>& into, std::size_t max);
+
+    std::size_t capacity() const { return ring.size(); }
+    std::size_t size() const;
+    // Pushes that found the queue full and had to wait
+    long long blockedPushes() const;
+
+private:
+    mutable std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    std::vector<StreamJob> ring;
+    std::size_t head = 0;
+    std::size_t count = 0;
+    bool closed = false;
+    long long blocked = 0;
+
+    void put(const StreamJob& job);
+};
+
+// Metrics over the jobs retired in one window of simulated time
+struct StreamWindow {
+    long long index = 0;        // window number, start / length
+    int start = 0;              // [start, end) in simulated time
+    int end = 0;
+    long long completed = 0;
+    long long rejected = 0;     // turned away at admission
+    double throughput = 0;      // completions per time unit
+    Distribution waiting;
+    Distribution turnaround;
+    Distribution response;
+    long long deadlineJobs = 0; // rejected ones included, as misses
+    long long deadlineMisses = 0;
+    std::size_t inFlight = 0;   // admitted and not yet retired, when emitted
+    std::size_t backlog = 0;    // waiting in the JobStream, when emitted
+};
+
+// Running totals over the whole stream. Stream-wide percentiles come from
+// sketches, whose size does not grow with the stream; their counts, sums
+// and extremes are exact.
+struct StreamTotals {
+    long long admitted = 0;
+    long long completed = 0;
+    long long rejected = 0;
+    QuantileSketch waiting;
+    QuantileSketch turnaround;
+    QuantileSketch response;
+    long long deadlineMisses = 0;
+    long long windows = 0;      // emitted
+    std::size_t peakInFlight = 0;
+};
+
+struct StreamOptions {
+    int window = 1000;                      // simulated time units per window
+    std::size_t batch = 256;                // jobs taken from the stream per lock
+    std::function<void(const StreamWindow&)> onWindow;
+};
+
+// Online simulation over an unbounded job feed. Jobs are admitted from a
+// JobStream as the simulation reaches their arrival, and retired as soon as
+// they finish: their metrics go into the current window and their table
+// row and handle go to the next arrival. Nothing grows with the length of
+// the stream: the table is as large as the most jobs ever in flight, the
+// Gantt chart and timeline are not recorded, a window keeps only its own
+// samples and the whole-stream distributions are sketched.
+//
+// Windows are cut by completion time and emitted once the run has passed
+// their end; a window in which nothing finished is skipped, which the
+// start/end of the next one shows. The last, partial window is emitted
+// when the stream ends.
+class StreamingSimulator : private JobRetirement {
+public:
+    StreamingSimulator(std::unique_ptr<Scheduler> scheduler, JobStream& input, StreamOptions options = {},
+                       std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+
+    // Until the stream is closed and every job has been retired
+    void run();
+    // One simulator step; blocks on the stream when the next decision
+    // depends on an arrival that has not come in yet. False once done.
+    bool step();
+
+    int getCurrentTime() const { return sim->getCurrentTime(); }
+    const StreamTotals& totals() const { return total; }
+    std::size_t inFlight() const { return sim->getJobTable().size() - freeHandles.size(); }
+    // Rows the table has grown to; the peak number of jobs in flight
+    std::size_t tableSize() const { return sim->getJobTable().size(); }
+    const Scheduler& getScheduler() const { return sim->getScheduler(); }
+    const RunCounters& getCounters() const { return sim->getCounters(); }
+
+private:
+    class Source;
+
+    JobStream& input;
+    StreamOptions options;
+    std::vector<JobHandle> freeHandles;     // retired rows, reused by the next arrivals
+    std::unique_ptr<Simulator> sim;
+    StreamTotals total;
+    bool finished = false;
+
+    // The window being filled
+    long long windowIndex = 0;
+    long long windowCompleted = 0;
+    long long windowRejected = 0;
+    long long windowDeadlineJobs = 0;
+    long long windowMisses = 0;
+    std::vector<std::int32_t> waiting, turnaround, response;
+
+    void retire(const JobTable& jobs, JobHandle job, int time) override;
+    void emit(int end);
+};
\ No newline at end of file
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "ThreadPool.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+enum class TaskState { Queued, Running, Finished, Cancelled, Failed };
+
+// Snapshot of one task, as poll() reports it
+struct TaskStatus {
+    long long id = 0;
+    std::string label;
+    TaskState state = TaskState::Queued;
+    double progress = -1;       // 0..1; negative while unknown
+    std::string note;           // what the task is doing now
+    std::string partial;        // latest partial result, if the task posts any
+    std::string report;         // finished: the result; failed: the error
+    double elapsedMs = 0;       // running or done; 0 while queued
+};
+
+// What a task hands back. `report` is kept for display; `apply` runs on the
+// thread that calls TaskExecutor::collect(), and is where a result may touch
+// state owned by that thread. A cancelled or failed task's apply is dropped.
+struct TaskOutcome {
+    std::string report;
+    std::function<void()> apply;
+};
+
+class TaskExecutor;
+
+// A running task's side of the executor. Cancellation is cooperative: long
+// loops check cancelled() (or hand cancelFlag() to code that takes one) and
+// return early.
+class TaskContext {
+public:
+    bool cancelled() const { return cancel.load(std::memory_order_relaxed); }
+    const std::atomic<bool>& cancelFlag() const { return cancel; }
+    void progress(double fraction, const std::string& note = std::string());
+    void partial(std::string text);
+
+private:
+    friend class TaskExecutor;
+    TaskContext(TaskExecutor& owner, long long id, const std::atomic<bool>& cancel)
+        : owner(owner), id(id), cancel(cancel) {}
+    TaskExecutor& owner;
+    long long id;
+    const std::atomic<bool>& cancel;
+};
+
+// Runs tasks in the background on a few worker threads, in submission order.
+// Everything else is for the submitting thread: poll() to see how tasks are
+// doing, cancel() to stop one, collect() to apply finished results.
+class TaskExecutor {
+public:
+    using Body = std::function<TaskOutcome(TaskContext&)>;
+
+    explicit TaskExecutor(unsigned workers = 1);
+    TaskExecutor(const TaskExecutor&) = delete;
+    TaskExecutor& operator=(const TaskExecutor&) = delete;
+    // Cancels whatever is left and waits for the running tasks to return
+    ~TaskExecutor();
+
+    long long submit(std::string label, Body body);
+    // A queued task is dropped; a running one is asked to stop. False if the
+    // task is unknown or already over.
+    bool cancel(long long id);
+    // Every task not cleared yet, oldest first
+    std::vector<TaskStatus> poll() const;
+    bool status(long long id, TaskStatus& into) const;
+    // Queued or running
+    std::size_t active() const;
+    // Runs the apply step of each task that finished since the last call, in
+    // the order they finished; returns how many ran
+    std::size_t collect();
+    // Forgets finished, cancelled and failed tasks
+    void clearFinished();
+    // Blocks until nothing is queued or running
+    void wait();
+
+    static const char* stateName(TaskState state);
+
+private:
+    struct Task {
+        long long id = 0;
+        std::string label;
+        Body body;
+        std::atomic<bool> cancel{ false };
+        TaskState state = TaskState::Queued;
+        double progress = -1;
+        std::string note;
+        std::string partial;
+        std::string report;
+        std::chrono::steady_clock::time_point started, ended;
+    };
+    friend class TaskContext;
+
+    mutable std::mutex mutex;
+    std::condition_variable idle;
+    std::map<long long, std::shared_ptr<Task>> tasks;
+    std::vector<std::function<void()>> applies;     // finished since the last collect()
+    long long nextId = 1;
+    std::size_t running = 0;
+    std::size_t queued = 0;
+    // Last, so the workers are joined before the tasks they use go away
+    ThreadPool pool;
+
+    void run(const std::shared_ptr<Task>& task);
+    TaskStatus snapshot(const Task& task) const;
+};
\ No newline at end of file
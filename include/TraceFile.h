@@ -0,0 +1,121 @@
+#pragma once
+
+#include "JobTable.h"
+#include "GanttChart.h"
+#include "CsvLoader.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+enum class TraceKind : std::uint32_t {
+    Jobs = 1,       // input job set: id, arrival, burst, priority, deadline, name
+    Schedule = 2    // completed run: the above plus remaining/start/completion and Gantt segments
+};
+
+// Fixed 64-byte header at offset 0. Columns follow in a fixed order, each
+// starting on an 8-byte boundary, so a mapped file can be used in place.
+struct TraceHeader {
+    char magic[8];              // "JSTRACE\0"
+    std::uint32_t version;
+    std::uint32_t kind;         // TraceKind
+    std::uint32_t endianTag;    // 0x01020304 in the writer's byte order
+    std::uint32_t reserved;
+    std::uint64_t jobCount;
+    std::uint64_t segmentCount;
+    std::uint64_t nameBytes;
+    std::uint64_t fileSize;
+    std::uint64_t reserved2;
+};
+static_assert(sizeof(TraceHeader) == 64, "trace header must stay 64 bytes");
+
+// Read-only view of a trace file. The file is memory-mapped where the
+// platform allows it and read into memory otherwise; either way the columns
+// are used as they are on disk, without parsing.
+class MappedTrace {
+public:
+    MappedTrace() = default;
+    MappedTrace(const MappedTrace&) = delete;
+    MappedTrace& operator=(const MappedTrace&) = delete;
+    ~MappedTrace();
+
+    bool open(const std::string& path, std::string& error);
+    // A trace already in memory, e.g. received over the network; the bytes
+    // are copied. `label` names it in error messages.
+    bool load(std::string_view bytes, const std::string& label, std::string& error);
+
+    TraceKind kind() const { return (TraceKind)header.kind; }
+    std::size_t jobCount() const { return (std::size_t)header.jobCount; }
+    std::size_t segmentCount() const { return (std::size_t)header.segmentCount; }
+
+    const std::int32_t* ids() const { return column<std::int32_t>(offsets.ids); }
+    const std::int32_t* arrivals() const { return column<std::int32_t>(offsets.arrivals); }
+    const std::int32_t* bursts() const { return column<std::int32_t>(offsets.bursts); }
+    const std::int32_t* priorities() const { return column<std::int32_t>(offsets.priorities); }
+    // Version 2 and later; null in version 1 traces, which have no deadlines
+    const std::int32_t* deadlines() const { return column<std::int32_t>(offsets.deadlines); }
+    // Schedule traces only; null otherwise
+    const std::int32_t* remainings() const { return column<std::int32_t>(offsets.remainings); }
+    const std::int32_t* starts() const { return column<std::int32_t>(offsets.starts); }
+    const std::int32_t* completions() const { return column<std::int32_t>(offsets.completions); }
+    const std::uint64_t* nameOffsets() const { return column<std::uint64_t>(offsets.nameOffsets); }
+    const char* names() const { return column<char>(offsets.names); }
+    const std::uint32_t* segmentJobs() const { return column<std::uint32_t>(offsets.segmentJobs); }
+    const std::int32_t* segmentStarts() const { return column<std::int32_t>(offsets.segmentStarts); }
+    const std::int32_t* segmentLengths() const { return column<std::int32_t>(offsets.segmentLengths); }
+
+    // Copies the columns into `jobs`; with `withResults` a schedule trace
+    // keeps its start/completion times, otherwise the jobs come back fresh
+    void appendTo(JobTable& jobs, bool withResults) const;
+    void appendTo(GanttChart& gantt, JobHandle firstJob = 0) const;
+
+    // Byte offset of every column, 0 when the kind has no such column
+    struct Layout {
+        std::uint64_t ids = 0, arrivals = 0, bursts = 0, priorities = 0, deadlines = 0;
+        std::uint64_t remainings = 0, starts = 0, completions = 0;
+        std::uint64_t nameOffsets = 0, names = 0;
+        std::uint64_t segmentJobs = 0, segmentStarts = 0, segmentLengths = 0;
+        std::uint64_t end = 0;
+    };
+    static Layout layoutFor(const TraceHeader& header);
+
+private:
+    const char* data = nullptr;
+    std::size_t size = 0;
+    bool mapped = false;
+    std::vector<std::uint64_t> buffer;   // fallback when the file cannot be mapped
+    TraceHeader header{};
+    Layout offsets;
+
+    template <typename T>
+    const T* column(std::uint64_t offset) const { return offset ? (const T*)(data + offset) : nullptr; }
+    void close();
+    void copy(const char* bytes, std::size_t count);
+    bool validate(const std::string& path, std::string& error);
+};
+
+// Versioned little-endian columnar trace files, plus conversion to and from
+// the CSV job format
+class TraceFile {
+public:
+    // Version 2 added the deadline column; version 1 files still load
+    static constexpr std::uint32_t kVersion = 2;
+
+    static bool writeJobs(const std::string& path, const JobTable& jobs, std::string& error);
+    static bool writeSchedule(const std::string& path, const JobTable& jobs, const GanttChart& gantt, std::string& error);
+    // Works on either kind; the jobs come back unscheduled
+    static bool readJobs(const std::string& path, JobTable& jobs, std::string& error);
+    static bool readSchedule(const std::string& path, JobTable& jobs, GanttChart& gantt, std::string& error);
+    // The same job-set format, in memory
+    static void encodeJobs(const JobTable& jobs, std::string& bytes);
+    static bool decodeJobs(std::string_view bytes, const std::string& label, JobTable& jobs, std::string& error);
+
+    // Fails only if either file cannot be opened; skipped CSV rows are
+    // reported through `rows` when given
+    static bool csvToTrace(const std::string& csvPath, const std::string& tracePath, std::string& error,
+                           CsvLoadResult* rows = nullptr);
+    static bool traceToCsv(const std::string& tracePath, const std::string& csvPath, std::string& error);
+    // Id rows when no job is named, name rows otherwise; a deadline column
+    // is added when any job has one
+    static bool writeCsv(const std::string& path, const JobTable& jobs, std::string& error);
+};
\ No newline at end of file
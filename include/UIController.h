@@ -6,7 +6,16 @@
 #include "SJFScheduler.h"
 #include "RoundRobinScheduler.h"
 #include "PriorityScheduler.h"
+#include "MLFQScheduler.h"
+#include "CFSScheduler.h"
+#include "EDFScheduler.h"
+#include "LLFScheduler.h"
 #include "Job.h"
+#include "Simulator.h"
+#include "IncrementalSimulator.h"
+#include "ResultCache.h"
+#include "ParameterSweep.h"
+#include "TaskExecutor.h"
 #include <vector>
 #include <string>
 #include <map>
@@ -26,9 +35,14 @@ private:
     std::vector<Job> jobs;
     std::unique_ptr<Scheduler> scheduler;
     std::string pluginPath;
-    int currentAlgorithm; // 0:FCFS, 1:SJF, 2:RR, 3:Priority
+    int currentAlgorithm; // 0:FCFS, 1:SJF, 2:RR, 3:Priority, 4:MLFQ, 5:CFS, 6:EDF, 7:LLF
     std::string theme;
     std::map<std::string, std::string> userSettings;
+    IncrementalSimulator runs;   // latest run of the selected algorithm over `jobs`
+    ResultCache results;         // finished runs by job set and configuration
+    // Background simulations, comparisons, sweeps and imports. Last, so its
+    // workers are stopped before the members they read go away.
+    TaskExecutor tasks;
 
     // Menu methods
     void showMainMenu();
@@ -42,6 +56,8 @@ private:
     void showStatisticsMenu();
     void handleStatisticsMenuInput(int choice);
     void showHelpOverlay();
+    void showTaskMenu();
+    void handleTaskMenuInput(int choice);
 
     // Job management
     void createJob();
@@ -49,17 +65,59 @@ private:
     void deleteJob();
     void importJobsCSV();
     void exportJobsCSV();
+    void importJobsTrace();
+    void exportJobsTrace();
 
     // Scheduler integration
     void switchAlgorithm(int algo);
     void updateScheduler();
+    std::unique_ptr<Scheduler> makeScheduler() const;
+    // The selected algorithm's run over the current jobs, re-simulated only
+    // as far as edits since the last one require; null if none is selected
+    const Simulator* simulate();
+    // The selected configuration's result over the current jobs from the
+    // cache, simulated and cached first if it is not there yet; null when
+    // the configuration is not cacheable
+    std::shared_ptr<const CachedRun> cachedRun();
+    // `view` of that result, cached or not
+    std::string renderRun(std::string (Scheduler::*view)() const);
+    // The selected run's table and chart, held by `cached` when they come
+    // from the cache; cached runs keep no timeline. Null if none is selected.
+    struct Schedule {
+        std::shared_ptr<const CachedRun> cached;
+        const JobTable* jobs = nullptr;
+        const GanttChart* gantt = nullptr;
+        const EventLog* events = nullptr;
+    };
+    Schedule currentSchedule();
 
     // Visualization
     void displayGanttChart();
     void displayTimelineLog();
+    void zoomGanttChart();
+    void exportGanttChart();
 
     // Statistics
     void displayStatistics();
+    void displayComparison();
+    void runParameterSweep();
+    void displayMultiCore();
+    void displayInstrumentation();
+    // Asks for a sweep grid and target; false if there is nothing to sweep
+    bool promptSweep(SweepGrid& grid, SweepOptions& options);
+
+    // Background tasks. Each one works on a snapshot taken when it starts,
+    // so the jobs can be edited while it runs.
+    void listTasks();
+    void viewTask();
+    void cancelTask();
+    void startSimulationTask();
+    void startComparisonTask();
+    void startSweepTask();
+    void startImportTask();
+    // The selected algorithm over the current jobs; the run lands in the
+    // result cache, so the views pick it up once it is done
+    long long submitSimulation();
 
     // Utility
     int getIntInput(const std::string& prompt, int min, int max);
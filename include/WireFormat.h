@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+// Little-endian encoding for what goes between machines, independent of the
+// host's byte order. Counts that are usually small go as LEB128 varints.
+class WireWriter {
+public:
+    explicit WireWriter(std::string& out) : out(out) {}
+
+    void u8(std::uint8_t v) { out.push_back((char)v); }
+    void u32(std::uint32_t v) {
+        for (int i = 0; i < 4; ++i) out.push_back((char)(v >> (8 * i)));
+    }
+    void u64(std::uint64_t v) {
+        for (int i = 0; i < 8; ++i) out.push_back((char)(v >> (8 * i)));
+    }
+    void i64(std::int64_t v) { u64((std::uint64_t)v); }
+    void f64(double v) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &v, sizeof bits);
+        u64(bits);
+    }
+    void varint(std::uint64_t v) {
+        while (v >= 0x80) {
+            out.push_back((char)(v | 0x80));
+            v >>= 7;
+        }
+        out.push_back((char)v);
+    }
+    void str(std::string_view s) {
+        varint(s.size());
+        out.append(s.data(), s.size());
+    }
+    void bytes(const void* data, std::size_t size) { out.append((const char*)data, size); }
+
+private:
+    std::string& out;
+};
+
+// Reads what WireWriter wrote. A read past the end, or a malformed varint,
+// returns zeros and leaves ok() false from then on, so a caller can decode a
+// whole message and check once.
+class WireReader {
+public:
+    WireReader(const char* data, std::size_t size) : p(data), end(data + size) {}
+    explicit WireReader(std::string_view s) : WireReader(s.data(), s.size()) {}
+
+    bool ok() const { return good; }
+    bool atEnd() const { return p == end; }
+    std::size_t remaining() const { return (std::size_t)(end - p); }
+
+    std::uint8_t u8() { return need(1) ? (std::uint8_t)*p++ : 0; }
+    std::uint32_t u32() {
+        if (!need(4)) return 0;
+        std::uint32_t v = 0;
+        for (int i = 0; i < 4; ++i) v |= (std::uint32_t)(std::uint8_t)p[i] << (8 * i);
+        p += 4;
+        return v;
+    }
+    std::uint64_t u64() {
+        if (!need(8)) return 0;
+        std::uint64_t v = 0;
+        for (int i = 0; i < 8; ++i) v |= (std::uint64_t)(std::uint8_t)p[i] << (8 * i);
+        p += 8;
+        return v;
+    }
+    std::int64_t i64() { return (std::int64_t)u64(); }
+    double f64() {
+        std::uint64_t bits = u64();
+        double v;
+        std::memcpy(&v, &bits, sizeof v);
+        return v;
+    }
+    std::uint64_t varint() {
+        std::uint64_t v = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (!need(1)) return 0;
+            std::uint8_t byte = (std::uint8_t)*p++;
+            v |= (std::uint64_t)(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) return v;
+        }
+        good = false;
+        return 0;
+    }
+    std::string str() {
+        std::string_view s = view(varint());
+        return std::string(s);
+    }
+    // The next `size` bytes, in place
+    std::string_view view(std::uint64_t size) {
+        if (!need(size)) return {};
+        std::string_view s(p, (std::size_t)size);
+        p += size;
+        return s;
+    }
+
+private:
+    const char* p;
+    const char* end;
+    bool good = true;
+
+    bool need(std::uint64_t bytes) {
+        if (good && bytes <= (std::uint64_t)(end - p)) return true;
+        good = false;
+        p = end;
+        return false;
+    }
+};
\ No newline at end of file
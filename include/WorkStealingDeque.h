@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Chase-Lev work-stealing deque (with the C11 orderings of Le et al., 2013).
+// One owner thread pushes and pops at the bottom without locking; any other
+// thread steals from the top with a single CAS. The ring doubles when full;
+// replaced rings stay alive until the deque is destroyed, since a thief may
+// still be reading one.
+template <typename T>
+class WorkStealingDeque {
+public:
+    explicit WorkStealingDeque(std::size_t capacity = 256) : top(0), bottom(0) {
+        std::size_t size = 1;
+        while (size < capacity) size <<= 1;
+        rings.push_back(std::make_unique<Ring>(size));
+        ring.store(rings.back().get(), std::memory_order_relaxed);
+    }
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // Owner only
+    void push(T item) {
+        std::int64_t b = bottom.load(std::memory_order_relaxed);
+        std::int64_t t = top.load(std::memory_order_acquire);
+        Ring* r = ring.load(std::memory_order_relaxed);
+        if (b - t > (std::int64_t)r->mask) {
+            rings.push_back(r->grow(t, b));
+            r = rings.back().get();
+            ring.store(r, std::memory_order_release);
+        }
+        r->store(b, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    // Owner only; newest item first
+    bool pop(T& item) {
+        std::int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        Ring* r = ring.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = top.load(std::memory_order_relaxed);
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        item = r->load(b);
+        if (t == b) {
+            // Last item: race the thieves for it
+            bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // Any thread; oldest item first. False when empty or when another thread
+    // took the item first.
+    bool steal(T& item) {
+        std::int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b) return false;
+        Ring* r = ring.load(std::memory_order_acquire);
+        item = r->load(t);
+        return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    // Exact for the owner, a snapshot for everyone else
+    std::size_t size() const {
+        std::int64_t b = bottom.load(std::memory_order_relaxed);
+        std::int64_t t = top.load(std::memory_order_relaxed);
+        return b > t ? (std::size_t)(b - t) : 0;
+    }
+    bool empty() const { return size() == 0; }
+
+private:
+    struct Ring {
+        std::size_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+
+        explicit Ring(std::size_t size) : mask(size - 1), slots(new std::atomic<T>[size]) {}
+        T load(std::int64_t i) const { return slots[i & mask].load(std::memory_order_relaxed); }
+        void store(std::int64_t i, T item) { slots[i & mask].store(item, std::memory_order_relaxed); }
+        std::unique_ptr<Ring> grow(std::int64_t t, std::int64_t b) const {
+            auto bigger = std::make_unique<Ring>((mask + 1) * 2);
+            for (std::int64_t i = t; i < b; ++i) bigger->store(i, load(i));
+            return bigger;
+        }
+    };
+
+    alignas(64) std::atomic<std::int64_t> top;
+    alignas(64) std::atomic<std::int64_t> bottom;
+    alignas(64) std::atomic<Ring*> ring;
+    std::vector<std::unique_ptr<Ring>> rings;   // owner only: current ring last
+};
\ No newline at end of file
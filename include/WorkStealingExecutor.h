@@ -0,0 +1,29 @@
+#pragma once
+
+#include "ArrivalSource.h"
+#include "JobTable.h"
+#include "Statistics.h"
+#include <chrono>
+#include <memory>
+
+struct ReplayResult {
+    JobTable jobs;             // arrival order; measured start / completion in ticks
+    Distribution dispatchNs;   // release to first dequeue, in nanoseconds
+    long long steals = 0;
+    double wallMs = 0;
+};
+
+// Prototype executor: real threads pulling work through a
+// WorkStealingScheduler, one deque per thread. replay() releases each job at
+// its arrival time and has a worker spin for its burst, one time unit lasting
+// `tick`, so the measured schedule can be set against a simulated one of the
+// same workload. Jobs run to completion; there is no preemption.
+class WorkStealingExecutor {
+public:
+    WorkStealingExecutor(unsigned threads, std::chrono::nanoseconds tick);
+    ReplayResult replay(std::shared_ptr<const SharedJobSet> jobs);
+
+private:
+    unsigned threads;
+    std::chrono::nanoseconds tick;
+};
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Scheduler.h"
+#include "WorkStealingDeque.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// Scheduler backed by one Chase-Lev deque per worker. Under Simulator it is a
+// single-threaded policy: enqueue pushes onto worker 0's deque and dequeue
+// takes its oldest entry, so jobs are served first come, first served. A
+// WorkStealingExecutor drives the per-worker side from real threads instead.
+class WorkStealingScheduler : public Scheduler {
+public:
+    explicit WorkStealingScheduler(unsigned workers = 1);
+    void enqueue(JobHandle job) override;
+    JobHandle dequeue() override;
+    bool hasJobs() const override;
+    void schedule(int currentTime) override;
+    void setJobs(const std::vector<Job>& jobs) override;
+    void attach(JobTable& jobs) override;
+    std::string getGanttChart() const override;
+    std::string getTimelineLog() const override;
+    std::string getStatistics() const override;
+    ~WorkStealingScheduler() override;
+
+    // Worker side: the thread running worker w is the only one calling
+    // push(w, ...) and the owner half of take(w)
+    unsigned workerCount() const { return (unsigned)deques.size(); }
+    void push(unsigned worker, JobHandle job);
+    // Newest job on the worker's own deque, else the oldest one it can steal
+    // from another worker; kNoJob if every deque looked empty
+    JobHandle take(unsigned worker);
+    long long steals() const { return stolen.load(std::memory_order_relaxed); }
+
+private:
+    std::vector<std::unique_ptr<WorkStealingDeque<JobHandle>>> deques;
+    std::atomic<long long> stolen;
+    void reset();
+};
\ No newline at end of file
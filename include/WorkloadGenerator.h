@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Job.h"
+#include "JobTable.h"
+#include <cstdint>
+#include <vector>
+
+enum class BurstDistribution {
+    Exponential,
+    Pareto          // heavy-tailed: most jobs short, a few very long
+};
+
+// Parameters of a synthetic job set. Defaults give a moderately loaded
+// system: one arrival every two time units on average, mean burst 1.6.
+struct WorkloadSpec {
+    std::size_t jobs = 1000;
+    std::uint64_t seed = 1;
+    double arrivalRate = 0.5;           // Poisson arrivals, jobs per time unit
+    BurstDistribution bursts = BurstDistribution::Exponential;
+    double meanBurst = 1.6;             // before rounding to whole time units, minimum 1
+    double paretoShape = 1.5;           // tail index, > 1; lower is heavier
+    int maxBurst = 10000;               // long tails are clamped here
+    int priorityLevels = 10;            // priorities 0 .. levels - 1
+    double prioritySkew = 1.0;          // Zipf exponent; 0 is uniform, higher favours priority 0
+    double deadlineSlack = 0;           // > 0: deadline = arrival + burst * (1 + slack)
+};
+
+// Seeded synthetic workloads. Sampling is done by inverse transform
+// directly over a 64-bit Mersenne Twister rather than through <random>'s
+// distributions, whose output differs between standard libraries, so a
+// spec and seed name the same job set everywhere.
+class WorkloadGenerator {
+public:
+    // Appends spec.jobs jobs, in arrival order, with ids 1..n after the
+    // table's existing jobs
+    static void generate(const WorkloadSpec& spec, JobTable& jobs);
+    static std::vector<Job> generateJobs(const WorkloadSpec& spec);
+};
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "../include/ArrivalSource.h"
+#include <algorithm>
+
+VectorArrivalSource::VectorArrivalSource(std::vector<Job> jobs)
+    : jobs(std::move(jobs)), cursor(0) {
+    // Stable so jobs arriving together keep their input order
+    std::stable_sort(this->jobs.begin(), this->jobs.end(), [](const Job& a, const Job& b) {
+        return a.arrivalTime < b.arrivalTime;
+    });
+}
+
+bool VectorArrivalSource::hasNext() {
+    return cursor < jobs.size();
+}
+
+int VectorArrivalSource::peekArrivalTime() {
+    return jobs[cursor].arrivalTime;
+}
+
+Job VectorArrivalSource::next() {
+    return std::move(jobs[cursor++]);
+}
+
+GeneratorArrivalSource::GeneratorArrivalSource(std::function<bool(Job&)> producer)
+    : producer(std::move(producer)), lookahead(-1, 0, 0, 0), buffered(false), exhausted(false) {}
+
+void GeneratorArrivalSource::fill() {
+    if (buffered || exhausted) return;
+    if (producer(lookahead)) buffered = true;
+    else exhausted = true;
+}
+
+bool GeneratorArrivalSource::hasNext() {
+    fill();
+    return buffered;
+}
+
+int GeneratorArrivalSource::peekArrivalTime() {
+    fill();
+    return lookahead.arrivalTime;
+}
+
+Job GeneratorArrivalSource::next() {
+    fill();
+    buffered = false;
+    return lookahead;
+}
+
+std::shared_ptr<const SharedJobSet> SharedJobSet::create(JobTable jobs) {
+    auto set = std::make_shared<SharedJobSet>();
+    set->jobs = std::move(jobs);
+    const JobTable& table = set->jobs;
+    set->order.resize(table.size());
+    for (JobHandle h = 0; h < table.size(); ++h) set->order[h] = h;
+    // Job lists usually come in arrival order already
+    const std::int32_t* arrivals = table.arrivalColumn();
+    if (std::is_sorted(arrivals, arrivals + table.size())) return set;
+    std::stable_sort(set->order.begin(), set->order.end(), [&table](JobHandle a, JobHandle b) {
+        return table.arrival(a) < table.arrival(b);
+    });
+    return set;
+}
+
+std::shared_ptr<const SharedJobSet> SharedJobSet::create(const std::vector<Job>& jobs) {
+    JobTable table;
+    table.reserve(jobs.size());
+    for (const auto& job : jobs) table.add(job.jobId, job.name, job.arrivalTime, job.burstTime, job.priority, job.deadline);
+    return create(std::move(table));
+}
+
+SharedArrivalSource::SharedArrivalSource(std::shared_ptr<const SharedJobSet> jobs, size_t start)
+    : jobs(std::move(jobs)), cursor(start) {}
+
+bool SharedArrivalSource::hasNext() {
+    return cursor < jobs->size();
+}
+
+int SharedArrivalSource::peekArrivalTime() {
+    return jobs->table().arrival(jobs->arrivalOrder()[cursor]);
+}
+
+Job SharedArrivalSource::next() {
+    const JobTable& table = jobs->table();
+    JobHandle h = jobs->arrivalOrder()[cursor++];
+    Job job(table.id(h), table.arrival(h), table.burst(h), table.priority(h), table.deadline(h));
+    job.name.assign(table.name(h));
+    return job;
+}
+
+JobHandle SharedArrivalSource::admit(JobTable& into) {
+    const JobTable& table = jobs->table();
+    JobHandle h = jobs->arrivalOrder()[cursor++];
+    return into.add(table.id(h), table.name(h), table.arrival(h), table.burst(h), table.priority(h), table.deadline(h));
+}
\ No newline at end of file
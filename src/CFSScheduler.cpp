@@ -0,0 +1,131 @@
+#include "../include/CFSScheduler.h"
+#include "../include/Statistics.h"
+#include <algorithm>
+#include <sstream>
+
+namespace {
+
+// Linux's sched_prio_to_weight: each nice step is about 10% of CPU
+const int kNiceWeights[40] = {
+    88761, 71755, 56483, 46273, 36291,
+    29154, 23254, 18705, 14949, 11916,
+     9548,  7620,  6100,  4904,  3906,
+     3121,  2501,  1991,  1586,  1277,
+     1024,   820,   655,   526,   423,
+      335,   272,   215,   172,   137,
+      110,    87,    70,    56,    45,
+       36,    29,    23,    18,    15,
+};
+
+const std::int64_t kNiceZeroWeight = 1024;
+const std::int64_t kVruntimeScale = 1024;
+
+}
+
+CFSScheduler::CFSScheduler(int targetLatency, int minGranularity)
+    : timeline(runMemory()), vruntime(runMemory()), dispatchedRemaining(runMemory()), placed(runMemory()),
+      minVruntime(0), queuedWeight(0), nextSeq(0),
+      targetLatency(std::max(1, targetLatency)), minGranularity(std::max(1, minGranularity)) {}
+
+int CFSScheduler::weightOf(int priority) {
+    return kNiceWeights[std::min(std::max(priority, -20), 19) + 20];
+}
+
+void CFSScheduler::enqueue(JobHandle job) {
+    if (job >= vruntime.size()) {
+        vruntime.resize(job + 1, 0);
+        dispatchedRemaining.resize(job + 1, -1);
+        placed.resize(job + 1, 0);
+    }
+    int weight = weightOf(table->priority(job));
+    if (dispatchedRemaining[job] >= 0) {
+        // Back from the CPU: charge what it ran, scaled by its weight
+        std::int64_t ran = dispatchedRemaining[job] - table->remaining(job);
+        vruntime[job] += ran * kNiceZeroWeight * kVruntimeScale / weight;
+        dispatchedRemaining[job] = -1;
+    } else if (!placed[job]) {
+        // Newcomers start level with the queue instead of at zero, so they
+        // cannot starve jobs that have been running for a while
+        vruntime[job] = minVruntime;
+        placed[job] = 1;
+    }
+    timeline.insert({ vruntime[job], nextSeq++, job });
+    queuedWeight += weight;
+}
+
+JobHandle CFSScheduler::dequeue() {
+    if (timeline.empty()) {
+        return kNoJob;
+    }
+    auto leftmost = timeline.begin();
+    JobHandle job = leftmost->job;
+    minVruntime = std::max(minVruntime, leftmost->vruntime);
+    timeline.erase(leftmost);
+    queuedWeight -= weightOf(table->priority(job));
+    dispatchedRemaining[job] = table->remaining(job);
+    return job;
+}
+
+bool CFSScheduler::hasJobs() const {
+    return !timeline.empty();
+}
+
+void CFSScheduler::schedule(int currentTime) {
+    // The tree is always in virtual runtime order
+}
+
+int CFSScheduler::timeSlice(JobHandle job, int currentTime) const {
+    // The job's weighted share of the scheduling period
+    std::int64_t running = (std::int64_t)timeline.size() + 1;
+    std::int64_t period = std::max<std::int64_t>(targetLatency, running * minGranularity);
+    std::int64_t weight = weightOf(table->priority(job));
+    std::int64_t slice = period * weight / (queuedWeight + weight);
+    return (int)std::max<std::int64_t>(minGranularity, slice);
+}
+
+std::vector<JobHandle> CFSScheduler::queuedJobs() const {
+    std::vector<JobHandle> queued;
+    queued.reserve(timeline.size());
+    for (const auto& key : timeline) queued.push_back(key.job);
+    return queued;
+}
+
+void CFSScheduler::recycle(JobHandle job) {
+    if (job >= placed.size()) return;
+    dispatchedRemaining[job] = -1;
+    placed[job] = 0;
+}
+
+CFSScheduler::~CFSScheduler() {}
+
+void CFSScheduler::attach(JobTable& jobs) {
+    releaseStorage(timeline);
+    releaseStorage(vruntime);
+    releaseStorage(dispatchedRemaining);
+    releaseStorage(placed);
+    Scheduler::attach(jobs);
+    minVruntime = 0;
+    queuedWeight = 0;
+    nextSeq = 0;
+}
+
+void CFSScheduler::setJobs(const std::vector<Job>& jobs) {
+    attach(ownTable);
+    attachGantt(ownGantt);
+    ownTable.clear();
+    for (const auto& job : jobs) {
+        enqueue(ownTable.add(job));
+    }
+}
+
+std::string CFSScheduler::getGanttChart() const {
+    return gantt->render(*table);
+}
+
+std::string CFSScheduler::getTimelineLog() const {
+    return events->format(*table);
+}
+
+std::string CFSScheduler::getStatistics() const {
+    return StatisticsEngine::report(*table, "CFS");
+}
\ No newline at end of file
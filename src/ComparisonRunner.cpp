@@ -0,0 +1,191 @@
+#include "../include/ComparisonRunner.h"
+#include "../include/Simulator.h"
+#include "../include/FCFSScheduler.h"
+#include "../include/SJFScheduler.h"
+#include "../include/RoundRobinScheduler.h"
+#include "../include/PriorityScheduler.h"
+#include "../include/MLFQScheduler.h"
+#include "../include/CFSScheduler.h"
+#include "../include/EDFScheduler.h"
+#include "../include/LLFScheduler.h"
+#include "../include/RunArena.h"
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+
+// Dispatches between checks of ComparisonOptions::cancel
+constexpr long long kCancelInterval = 4096;
+
+bool cancelRequested(const std::atomic<bool>* cancel) {
+    return cancel && cancel->load(std::memory_order_relaxed);
+}
+
+// Runs to the end unless `cancel` is raised first; false if it was
+bool runUnlessCancelled(Simulator& sim, const std::atomic<bool>* cancel) {
+    if (!cancel) {
+        sim.run();
+        return true;
+    }
+    long long dispatches = 0;
+    while (sim.step()) {
+        if (++dispatches % kCancelInterval == 0 && cancelRequested(cancel)) return false;
+    }
+    return true;
+}
+
+}
+
+std::vector<SchedulerConfig> ComparisonRunner::defaultConfigs() {
+    std::vector<SchedulerConfig> configs;
+    configs.push_back({ "FCFS", [] { return std::make_unique<FCFSScheduler>(); } });
+    configs.push_back({ "SJF", [] { return std::make_unique<SJFScheduler>(); } });
+    for (int quantum : { 1, 2, 4, 8 }) {
+        configs.push_back({ "RR q=" + std::to_string(quantum),
+                            [quantum] { return std::make_unique<RoundRobinScheduler>(quantum); } });
+    }
+    for (int threshold : { 2, 5, 10 }) {
+        for (int increment : { 1, 2 }) {
+            configs.push_back({ "Priority t=" + std::to_string(threshold) + " i=" + std::to_string(increment),
+                                [threshold, increment] { return std::make_unique<PriorityScheduler>(threshold, increment); } });
+        }
+    }
+    configs.push_back({ "MLFQ", [] { return std::make_unique<MLFQScheduler>(); } });
+    configs.push_back({ "CFS", [] { return std::make_unique<CFSScheduler>(); } });
+    configs.push_back({ "EDF", [] { return std::make_unique<EDFScheduler>(); } });
+    configs.push_back({ "EDF + admission", [] { return std::make_unique<EDFScheduler>(true); } });
+    configs.push_back({ "LLF", [] { return std::make_unique<LLFScheduler>(); } });
+    return configs;
+}
+
+namespace {
+
+// One config's run; `jobsHash` is the set's hash when options.cache is set
+ComparisonResult runOne(const std::shared_ptr<const SharedJobSet>& jobs, const SchedulerConfig& config,
+                        const ComparisonOptions& options, std::uint64_t jobsHash) {
+    ResultCache* cache = options.cache;
+    bool sketches = options.sketches;
+    auto begin = std::chrono::steady_clock::now();
+    auto scheduler = config.create();
+    std::string key = cache ? scheduler->configKey() : std::string();
+    ComparisonResult result;
+    result.label = config.label;
+    if (cancelRequested(options.cancel)) {
+        result.cancelled = true;
+    } else if (auto hit = cache ? cache->find(*jobs, jobsHash, key) : nullptr) {
+        if (sketches) result.sketches = std::make_shared<RunSketches>(RunSketches::fromTable(hit->jobs));
+        else result.stats = StatisticsEngine::compute(hit->jobs);
+        result.cached = true;
+    } else {
+        // Each worker's arena is reused by every config it runs
+        RunArena::Scope arena;
+        Simulator sim(std::move(scheduler), std::make_unique<SharedArrivalSource>(jobs), arena.resource());
+        sim.setEventLogging(false);
+        sim.setSketching(sketches);
+        if (!runUnlessCancelled(sim, options.cancel)) {
+            result.cancelled = true;
+        } else {
+            if (sketches) result.sketches = std::make_shared<RunSketches>(*sim.getSketches());
+            else result.stats = StatisticsEngine::compute(sim.getJobTable());
+            if (!key.empty()) cache->store(jobsHash, key, sim.getJobTable(), sim.getGanttChart());
+        }
+    }
+    if (result.sketches) result.stats = result.sketches->statistics();
+    result.wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    if (options.onResult) options.onResult(result);
+    return result;
+}
+
+}
+
+bool ComparisonRunner::findConfig(const std::string& label, SchedulerConfig& into) {
+    for (auto& config : defaultConfigs()) {
+        if (config.label == label) {
+            into = std::move(config);
+            return true;
+        }
+    }
+    // Off-grid knobs for the two tunable families, as the sweep labels them
+    int a = 0, b = 0;
+    char tail = 0;
+    if (std::sscanf(label.c_str(), "RR q=%d%c", &a, &tail) == 1 && a > 0) {
+        into = { label, [a] { return std::make_unique<RoundRobinScheduler>(a); } };
+        return true;
+    }
+    if (std::sscanf(label.c_str(), "Priority t=%d i=%d%c", &a, &b, &tail) == 2 && a >= 0 && b >= 0) {
+        into = { label, [a, b] { return std::make_unique<PriorityScheduler>(a, b); } };
+        return true;
+    }
+    return false;
+}
+
+ComparisonResult ComparisonRunner::runConfig(std::shared_ptr<const SharedJobSet> jobs, const SchedulerConfig& config,
+                                             const ComparisonOptions& options) {
+    return runOne(jobs, config, options, options.cache ? ResultCache::hashJobs(*jobs) : 0);
+}
+
+std::vector<ComparisonResult> ComparisonRunner::run(std::shared_ptr<const SharedJobSet> jobs,
+                                                    const std::vector<SchedulerConfig>& configs,
+                                                    ThreadPool& pool, const ComparisonOptions& options) {
+    std::uint64_t jobsHash = options.cache ? ResultCache::hashJobs(*jobs) : 0;
+    std::vector<std::future<ComparisonResult>> pending;
+    pending.reserve(configs.size());
+    for (const auto& config : configs)
+        pending.push_back(pool.submit([jobs, &config, &options, jobsHash] { return runOne(jobs, config, options, jobsHash); }));
+    std::vector<ComparisonResult> results;
+    results.reserve(configs.size());
+    for (auto& result : pending) results.push_back(result.get());
+    return results;
+}
+
+std::vector<ComparisonResult> ComparisonRunner::run(std::shared_ptr<const SharedJobSet> jobs,
+                                                    const std::vector<SchedulerConfig>& configs,
+                                                    ThreadPool& pool, ResultCache* cache) {
+    ComparisonOptions options;
+    options.cache = cache;
+    return run(std::move(jobs), configs, pool, options);
+}
+
+std::vector<ComparisonResult> ComparisonRunner::run(std::shared_ptr<const SharedJobSet> jobs,
+                                                    const std::vector<SchedulerConfig>& configs,
+                                                    unsigned threads, ResultCache* cache) {
+    ThreadPool pool(threads);
+    return run(std::move(jobs), configs, pool, cache);
+}
+
+std::string ComparisonRunner::formatTable(const std::vector<ComparisonResult>& results) {
+    std::ostringstream oss;
+    // A deadline miss column only when the job set has deadlines
+    bool deadlines = false;
+    for (const auto& result : results) deadlines = deadlines || result.stats.deadlineJobs > 0;
+    oss << std::fixed << std::setprecision(2);
+    oss << std::left << std::setw(20) << "Algorithm" << std::right
+        << std::setw(12) << "Avg WT" << std::setw(11) << "p95 WT" << std::setw(11) << "p99 WT"
+        << std::setw(12) << "Avg TT" << std::setw(11) << "p99 TT"
+        << std::setw(12) << "Avg RT" << std::setw(10) << "Thruput"
+        << std::setw(8) << "CPU%" << std::setw(11) << "Makespan";
+    if (deadlines) oss << std::setw(8) << "Miss%";
+    oss << std::setw(10) << "Sim ms" << "\n";
+    const ComparisonResult* best = nullptr;
+    for (const auto& result : results) {
+        const RunStatistics& s = result.stats;
+        if (result.cancelled) {
+            oss << std::left << std::setw(20) << result.label << std::right << std::setw(12) << "cancelled" << "\n";
+            continue;
+        }
+        oss << std::left << std::setw(20) << result.label << std::right
+            << std::setw(12) << s.waiting.mean << std::setw(11) << s.waiting.p95 << std::setw(11) << s.waiting.p99
+            << std::setw(12) << s.turnaround.mean << std::setw(11) << s.turnaround.p99
+            << std::setw(12) << s.response.mean << std::setw(10) << std::setprecision(4) << s.throughput
+            << std::setprecision(2) << std::setw(8) << s.cpuUtilization * 100
+            << std::setw(11) << s.makespan;
+        if (deadlines) oss << std::setw(8) << s.deadlineMissRate * 100;
+        if (result.cached) oss << std::setw(10) << "cached" << "\n";
+        else oss << std::setw(10) << result.wallMs << "\n";
+        if (s.jobs > 0 && (!best || s.waiting.mean < best->stats.waiting.mean)) best = &result;
+    }
+    if (best) oss << "Lowest average waiting time: " << best->label << "\n";
+    return oss.str();
+}
\ No newline at end of file
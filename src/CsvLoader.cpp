@@ -0,0 +1,195 @@
+#include "../include/CsvLoader.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CSV_LOADER_MMAP 1
+#endif
+
+namespace {
+
+constexpr std::size_t kReadBlock = 4 << 20;
+
+std::string_view trim(std::string_view s) {
+    while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) s.remove_prefix(1);
+    while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '\r')) s.remove_suffix(1);
+    return s;
+}
+
+bool parseInt(std::string_view field, int& value) {
+    const char* end = field.data() + field.size();
+    auto [ptr, ec] = std::from_chars(field.data(), end, value);
+    return ec == std::errc() && ptr == end && !field.empty();
+}
+
+bool equalsIgnoreCase(std::string_view s, const char* word) {
+    std::size_t n = std::strlen(word);
+    if (s.size() != n) return false;
+    for (std::size_t i = 0; i < n; ++i)
+        if (std::tolower((unsigned char)s[i]) != word[i]) return false;
+    return true;
+}
+
+// Incremental line parser; the same state machine serves the mapped file
+// (one call) and block-wise reads (one call per block).
+template <typename Sink>
+class RowParser {
+public:
+    explicit RowParser(Sink& sink) : sink(sink) {}
+
+    // Parses every complete line in [begin, end), and the trailing partial
+    // line too when `last` is set. Returns where the unparsed tail starts.
+    const char* feed(const char* begin, const char* end, bool last) {
+        const char* p = begin;
+        while (p < end) {
+            const char* nl = (const char*)std::memchr(p, '\n', end - p);
+            if (!nl && !last) break;
+            const char* lineEnd = nl ? nl : end;
+            row(std::string_view(p, lineEnd - p));
+            p = nl ? nl + 1 : end;
+        }
+        return p;
+    }
+
+    CsvLoadResult result;
+
+private:
+    Sink& sink;
+    std::size_t lineNo = 0;
+    bool seenFirstRow = false;
+    int nextId = 1;
+
+    void error(std::string message) {
+        ++result.errorCount;
+        if (result.errors.size() < CsvLoadResult::kMaxReportedErrors)
+            result.errors.push_back({ lineNo, std::move(message) });
+    }
+
+    void row(std::string_view line) {
+        ++lineNo;
+        if (trim(line).empty()) return;
+
+        std::string_view fields[5];
+        std::size_t count = 0;
+        while (true) {
+            std::size_t comma = line.find(',');
+            if (count < 5) fields[count] = trim(line.substr(0, comma));
+            ++count;
+            if (comma == std::string_view::npos) break;
+            line.remove_prefix(comma + 1);
+        }
+
+        if (!seenFirstRow) {
+            seenFirstRow = true;
+            if (equalsIgnoreCase(fields[0], "id") || equalsIgnoreCase(fields[0], "name")) return;
+        }
+        if (count != 4 && count != 5) {
+            error("expected 4 or 5 fields, found " + std::to_string(count));
+            return;
+        }
+
+        int id, arrival, burst, priority, deadline = kNoDeadline;
+        std::string_view name;
+        if (!parseInt(fields[0], id)) {
+            if (fields[0].empty()) { error("empty job name"); return; }
+            name = fields[0];
+            id = nextId;
+        }
+        if (!parseInt(fields[1], arrival)) { error("invalid arrival time '" + std::string(fields[1]) + "'"); return; }
+        if (!parseInt(fields[2], burst)) { error("invalid burst time '" + std::string(fields[2]) + "'"); return; }
+        if (!parseInt(fields[3], priority)) { error("invalid priority '" + std::string(fields[3]) + "'"); return; }
+        if (burst < 0) { error("negative burst time"); return; }
+        if (count == 5 && !fields[4].empty()) {
+            if (!parseInt(fields[4], deadline)) { error("invalid deadline '" + std::string(fields[4]) + "'"); return; }
+            if (deadline < 0) { error("negative deadline"); return; }
+        }
+
+        if (!name.empty()) ++nextId;
+        sink(id, name, arrival, burst, priority, deadline);
+        ++result.rows;
+    }
+};
+
+// Maps or block-reads the file and runs it through the parser. `reserve`
+// gets a row-count estimate up front when the whole file is visible.
+template <typename Sink, typename Reserve>
+CsvLoadResult loadFile(const std::string& path, Sink& sink, Reserve reserve) {
+    RowParser<Sink> parser(sink);
+#ifdef CSV_LOADER_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return parser.result;
+    struct stat st;
+    if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+        std::size_t size = (std::size_t)st.st_size;
+        void* map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+            ::madvise(map, size, MADV_SEQUENTIAL);
+            const char* data = (const char*)map;
+            reserve((std::size_t)std::count(data, data + size, '\n') + 1);
+            parser.feed(data, data + size, true);
+            ::munmap(map, size);
+            ::close(fd);
+            parser.result.opened = true;
+            return parser.result;
+        }
+    }
+    ::close(fd);
+#endif
+    // Buffered fallback: large blocks, with a partial last line carried over
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) return parser.result;
+    parser.result.opened = true;
+    std::vector<char> buffer(kReadBlock);
+    std::size_t carried = 0;
+    while (true) {
+        if (carried == buffer.size()) buffer.resize(buffer.size() * 2);   // line longer than a block
+        std::size_t got = std::fread(buffer.data() + carried, 1, buffer.size() - carried, file);
+        bool last = got == 0;
+        const char* end = buffer.data() + carried + got;
+        const char* rest = parser.feed(buffer.data(), end, last);
+        carried = end - rest;
+        std::memmove(buffer.data(), rest, carried);
+        if (last) break;
+    }
+    std::fclose(file);
+    return parser.result;
+}
+
+}
+
+CsvLoadResult CsvJobLoader::load(const std::string& path, JobTable& jobs) {
+    auto sink = [&jobs](int id, std::string_view name, int arrival, int burst, int priority, int deadline) {
+        jobs.add(id, name, arrival, burst, priority, deadline);
+    };
+    return loadFile(path, sink, [&jobs](std::size_t rows) { jobs.reserve(jobs.size() + rows); });
+}
+
+CsvLoadResult CsvJobLoader::load(const std::string& path, std::vector<Job>& jobs) {
+    auto sink = [&jobs](int id, std::string_view name, int arrival, int burst, int priority, int deadline) {
+        if (name.empty()) {
+            jobs.emplace_back(id, arrival, burst, priority, deadline);
+        } else {
+            jobs.emplace_back(std::string(name), arrival, burst, priority, deadline);
+            jobs.back().jobId = id;
+        }
+    };
+    return loadFile(path, sink, [&jobs](std::size_t rows) { jobs.reserve(jobs.size() + rows); });
+}
+
+CsvLoadResult CsvJobLoader::load(const std::string& path, const RowSink& sink) {
+    return loadFile(path, sink, [](std::size_t) {});
+}
+
+CsvLoadResult CsvJobLoader::parse(std::string_view text, const RowSink& sink) {
+    RowParser<const RowSink> parser(sink);
+    parser.feed(text.data(), text.data() + text.size(), true);
+    parser.result.opened = true;
+    return parser.result;
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+#include "../include/DeadlineAdmission.h"
+#include <algorithm>
+#include <utility>
+
+bool DeadlineAdmission::admit(JobHandle job, const std::pmr::vector<JobHandle>& queued, const JobTable& jobs) {
+    if (!jobs.hasDeadline(job)) return true;
+    long long now = jobs.arrival(job);
+    long long due = jobs.deadline(job);
+    long long extra = jobs.remaining(job);
+
+    std::vector<std::pair<int, int>> work;   // (deadline, remaining)
+    work.reserve(queued.size());
+    for (JobHandle other : queued)
+        if (jobs.hasDeadline(other)) work.push_back({ jobs.deadline(other), jobs.remaining(other) });
+    std::sort(work.begin(), work.end());
+
+    // Work due no later than the new job runs before it; everything due
+    // later is delayed by its whole burst
+    long long done = now;
+    std::size_t i = 0;
+    for (; i < work.size() && work[i].first <= due; ++i) done += work[i].second;
+    if (done + extra > due) return false;
+    for (; i < work.size(); ++i) {
+        done += work[i].second;
+        if (done <= work[i].first && done + extra > work[i].first) return false;
+    }
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,676 @@
+#include "../include/DistributedSweep.h"
+#include "../include/ArrivalSource.h"
+#include "../include/ThreadPool.h"
+#include "../include/TraceFile.h"
+#include "../include/WireFormat.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#define DISTRIBUTED_SWEEP_POSIX 1
+#endif
+
+namespace {
+
+enum class Message : std::uint8_t {
+    Hello = 1,      // worker: protocol version, threads, host name
+    Segment = 2,    // coordinator: segment id, name, trace bytes
+    Task = 3,       // coordinator: task id, segment id, config label
+    Result = 4,     // worker: task id, ok, then wall ms and sketches or an error
+    Forget = 5,     // coordinator: segment id, no tasks left on it
+    Shutdown = 6    // coordinator: the sweep is over
+};
+
+// Frames are a u32 length (type byte plus payload), the type, the payload.
+// Segments are the only large ones.
+constexpr std::uint64_t kMaxFrame = std::uint64_t(1) << 31;
+
+void frameHeader(std::string& out, Message type, std::uint64_t payloadBytes) {
+    WireWriter w(out);
+    w.u32((std::uint32_t)(payloadBytes + 1));
+    w.u8((std::uint8_t)type);
+}
+
+std::string frame(Message type, const std::string& payload) {
+    std::string out;
+    frameHeader(out, type, payload.size());
+    out += payload;
+    return out;
+}
+
+void log(const std::function<void(const std::string&)>& sink, const std::string& line) {
+    if (sink) sink(line);
+}
+
+// A CSV field in quotes, embedded quotes doubled
+std::string quoted(const std::string& field) {
+    std::string out = "\"";
+    for (char c : field) {
+        if (c == '"') out += '"';
+        out += c;
+    }
+    return out + '"';
+}
+
+#ifdef DISTRIBUTED_SWEEP_POSIX
+
+#ifdef MSG_NOSIGNAL
+constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+constexpr int kSendFlags = 0;
+#endif
+
+void configureSocket(int fd) {
+    int one = 1;
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof one);
+#ifdef SO_NOSIGPIPE
+    ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof one);
+#endif
+}
+
+// Blocking send of the whole buffer
+bool sendAll(int fd, const char* data, std::size_t size) {
+    while (size > 0) {
+        ssize_t sent = ::send(fd, data, size, kSendFlags);
+        if (sent < 0 && errno == EINTR) continue;
+        if (sent <= 0) return false;
+        data += sent;
+        size -= (std::size_t)sent;
+    }
+    return true;
+}
+
+bool recvAll(int fd, char* data, std::size_t size) {
+    while (size > 0) {
+        ssize_t got = ::recv(fd, data, size, 0);
+        if (got < 0 && errno == EINTR) continue;
+        if (got <= 0) return false;
+        data += got;
+        size -= (std::size_t)got;
+    }
+    return true;
+}
+
+// Blocking read of one frame
+bool readFrame(int fd, Message& type, std::string& payload) {
+    char header[5];
+    if (!recvAll(fd, header, sizeof header)) return false;
+    WireReader r(header, sizeof header);
+    std::uint32_t length = r.u32();
+    type = (Message)r.u8();
+    if (length == 0 || length > kMaxFrame) return false;
+    payload.resize(length - 1);
+    return recvAll(fd, &payload[0], payload.size());
+}
+
+std::string peerName(const sockaddr_storage& addr) {
+    char host[INET6_ADDRSTRLEN] = "?";
+    unsigned port = 0;
+    if (addr.ss_family == AF_INET) {
+        const auto& in = (const sockaddr_in&)addr;
+        ::inet_ntop(AF_INET, &in.sin_addr, host, sizeof host);
+        port = ntohs(in.sin_port);
+    } else if (addr.ss_family == AF_INET6) {
+        const auto& in6 = (const sockaddr_in6&)addr;
+        ::inet_ntop(AF_INET6, &in6.sin6_addr, host, sizeof host);
+        port = ntohs(in6.sin6_port);
+    }
+    return std::string(host) + ":" + std::to_string(port);
+}
+
+// One worker as the coordinator sees it. Output is queued as shared chunks
+// so a segment's bytes are never copied per worker.
+struct Connection {
+    int fd = -1;
+    std::string peer;
+    bool ready = false;             // Hello received
+    std::size_t slots = 0;
+    std::string in;
+    std::deque<std::shared_ptr<const std::string>> out;
+    std::size_t outOffset = 0;      // into out.front()
+    std::set<std::size_t> outstanding;
+    std::set<std::size_t> segments; // sent and not forgotten
+
+    void queue(std::string bytes) { out.push_back(std::make_shared<const std::string>(std::move(bytes))); }
+    void queue(std::shared_ptr<const std::string> bytes) { out.push_back(std::move(bytes)); }
+
+    // Writes what the socket takes now; false once the peer is gone
+    bool flush() {
+        while (!out.empty()) {
+            const std::string& chunk = *out.front();
+            ssize_t sent = ::send(fd, chunk.data() + outOffset, chunk.size() - outOffset, kSendFlags);
+            if (sent < 0) {
+                if (errno == EINTR) continue;
+                return errno == EAGAIN || errno == EWOULDBLOCK;
+            }
+            outOffset += (std::size_t)sent;
+            if (outOffset == chunk.size()) {
+                out.pop_front();
+                outOffset = 0;
+            }
+        }
+        return true;
+    }
+};
+
+class Coordinator {
+public:
+    Coordinator(const std::vector<std::string>& configs, const std::vector<TraceSegment>& segments,
+                const CoordinatorOptions& options, std::vector<ShardResult>& results)
+        : configs(configs), segments(segments), options(options), results(results) {}
+
+    bool run(std::string& error) {
+        std::size_t total = configs.size() * segments.size();
+        results.assign(total, ShardResult());
+        remainingOnSegment.assign(segments.size(), configs.size());
+        // Segment-major, so the first workers to join start on different
+        // configs of the same segment rather than each pulling its own segment
+        for (std::size_t s = 0; s < segments.size(); ++s) {
+            for (std::size_t c = 0; c < configs.size(); ++c) {
+                std::size_t task = c * segments.size() + s;
+                results[task].config = c;
+                results[task].segment = s;
+                pending.push_back(task);
+            }
+        }
+        if (total == 0) return true;
+        if (!listen(error)) return false;
+        log(options.log, "Listening on port " + std::to_string(options.port) + " for " + std::to_string(total) +
+                             " tasks (" + std::to_string(configs.size()) + " configs x " +
+                             std::to_string(segments.size()) + " segments)");
+
+        while (settled < total) {
+            std::vector<pollfd> fds;
+            fds.push_back({ listener, POLLIN, 0 });
+            for (const auto& conn : connections)
+                fds.push_back({ conn->fd, (short)(POLLIN | (conn->out.empty() ? 0 : POLLOUT)), 0 });
+            if (::poll(fds.data(), fds.size(), 1000) < 0 && errno != EINTR) {
+                error = std::string("poll failed: ") + std::strerror(errno);
+                break;
+            }
+            if (fds[0].revents & POLLIN) accept();
+            // Connections accepted just now are not in `fds` yet
+            std::vector<Connection*> dropped;
+            for (std::size_t i = 1; i < fds.size(); ++i) {
+                Connection& conn = *connections[i - 1];
+                bool alive = true;
+                if (fds[i].revents & (POLLIN | POLLHUP | POLLERR)) alive = receive(conn);
+                if (alive && (fds[i].revents & POLLOUT)) alive = conn.flush();
+                if (!alive) dropped.push_back(&conn);
+            }
+            for (Connection* conn : dropped) drop(*conn);
+            dispatch();
+        }
+
+        for (auto& conn : connections) {
+            conn->queue(frame(Message::Shutdown, std::string()));
+            // Blocking for the last few bytes; a worker that has gone is skipped
+            int flags = ::fcntl(conn->fd, F_GETFL, 0);
+            ::fcntl(conn->fd, F_SETFL, flags & ~O_NONBLOCK);
+            conn->flush();
+            ::close(conn->fd);
+        }
+        connections.clear();
+        ::close(listener);
+        return error.empty();
+    }
+
+private:
+    const std::vector<std::string>& configs;
+    const std::vector<TraceSegment>& segments;
+    const CoordinatorOptions& options;
+    std::vector<ShardResult>& results;
+    std::deque<std::size_t> pending;
+    std::vector<std::size_t> remainingOnSegment;
+    std::size_t settled = 0;
+    int listener = -1;
+    std::vector<std::unique_ptr<Connection>> connections;
+
+    bool listen(std::string& error) {
+        listener = ::socket(AF_INET6, SOCK_STREAM, 0);
+        bool v6 = listener >= 0;
+        if (!v6) listener = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (listener < 0) {
+            error = std::string("cannot create socket: ") + std::strerror(errno);
+            return false;
+        }
+        int one = 1, zero = 0;
+        ::setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof one);
+        int bound;
+        if (v6) {
+            // Both IPv4 and IPv6 workers
+            ::setsockopt(listener, IPPROTO_IPV6, IPV6_V6ONLY, &zero, sizeof zero);
+            sockaddr_in6 addr{};
+            addr.sin6_family = AF_INET6;
+            addr.sin6_addr = in6addr_any;
+            addr.sin6_port = htons(options.port);
+            bound = ::bind(listener, (const sockaddr*)&addr, sizeof addr);
+        } else {
+            sockaddr_in addr{};
+            addr.sin_family = AF_INET;
+            addr.sin_addr.s_addr = htonl(INADDR_ANY);
+            addr.sin_port = htons(options.port);
+            bound = ::bind(listener, (const sockaddr*)&addr, sizeof addr);
+        }
+        if (bound < 0 || ::listen(listener, 64) < 0) {
+            error = "cannot listen on port " + std::to_string(options.port) + ": " + std::strerror(errno);
+            ::close(listener);
+            return false;
+        }
+        ::fcntl(listener, F_SETFL, ::fcntl(listener, F_GETFL, 0) | O_NONBLOCK);
+        return true;
+    }
+
+    void accept() {
+        while (true) {
+            sockaddr_storage addr{};
+            socklen_t len = sizeof addr;
+            int fd = ::accept(listener, (sockaddr*)&addr, &len);
+            if (fd < 0) return;
+            configureSocket(fd);
+            ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+            auto conn = std::make_unique<Connection>();
+            conn->fd = fd;
+            conn->peer = peerName(addr);
+            connections.push_back(std::move(conn));
+        }
+    }
+
+    // Reads and handles whatever has arrived; false once the connection
+    // should be dropped
+    bool receive(Connection& conn) {
+        char block[1 << 16];
+        while (true) {
+            ssize_t got = ::recv(conn.fd, block, sizeof block, 0);
+            if (got > 0) {
+                conn.in.append(block, (std::size_t)got);
+                continue;
+            }
+            if (got < 0 && errno == EINTR) continue;
+            if (got < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+            // Closed, or failed: handle what did arrive, then drop
+            handleFrames(conn);
+            return false;
+        }
+        return handleFrames(conn);
+    }
+
+    bool handleFrames(Connection& conn) {
+        std::size_t at = 0;
+        bool ok = true;
+        while (ok && conn.in.size() - at >= 5) {
+            WireReader header(conn.in.data() + at, 5);
+            std::uint32_t length = header.u32();
+            if (length == 0 || length > kMaxFrame) { ok = false; break; }
+            if (conn.in.size() - at - 4 < length) break;
+            Message type = (Message)header.u8();
+            ok = handle(conn, type, WireReader(conn.in.data() + at + 5, length - 1));
+            at += 4 + (std::size_t)length;
+        }
+        conn.in.erase(0, at);
+        return ok;
+    }
+
+    bool handle(Connection& conn, Message type, WireReader in) {
+        if (type == Message::Hello) {
+            std::uint32_t version = in.u32();
+            std::uint64_t slots = in.varint();
+            std::string host = in.str();
+            if (!in.ok() || version != DistributedSweep::kProtocolVersion || slots == 0) {
+                log(options.log, "Rejected " + conn.peer + ": protocol version " + std::to_string(version) +
+                                     ", expected " + std::to_string(DistributedSweep::kProtocolVersion));
+                return false;
+            }
+            conn.ready = true;
+            conn.slots = (std::size_t)std::min<std::uint64_t>(slots, 1024);
+            conn.peer = host + " (" + conn.peer + ")";
+            log(options.log, "Worker " + conn.peer + " joined with " + std::to_string(conn.slots) + " threads");
+            return true;
+        }
+        if (type != Message::Result || !conn.ready) return false;
+        std::uint64_t task = in.varint();
+        std::uint8_t ok = in.u8();
+        if (!in.ok() || !conn.outstanding.count((std::size_t)task)) return false;
+        ShardResult& result = results[(std::size_t)task];
+        if (ok) {
+            result.wallMs = in.f64();
+            if (!result.sketches.decode(in)) return false;
+            result.done = true;
+        } else {
+            result.error = in.str();
+            if (!in.ok()) return false;
+        }
+        result.worker = conn.peer;
+        conn.outstanding.erase((std::size_t)task);
+        settle(result);
+        return true;
+    }
+
+    void settle(const ShardResult& result) {
+        ++settled;
+        std::ostringstream line;
+        line << "[" << settled << "/" << results.size() << "] " << configs[result.config] << " on "
+             << segments[result.segment].name;
+        if (result.done) line << ": " << (long long)result.wallMs << " ms on " << result.worker;
+        else line << ": failed, " << result.error;
+        log(options.log, line.str());
+        // Workers can let go of a segment nothing else will run on
+        if (--remainingOnSegment[result.segment] > 0) return;
+        std::string payload;
+        WireWriter(payload).varint(result.segment);
+        for (auto& conn : connections) {
+            if (conn->segments.erase(result.segment)) conn->queue(frame(Message::Forget, payload));
+        }
+    }
+
+    void drop(Connection& conn) {
+        if (conn.ready) log(options.log, "Worker " + conn.peer + " left with " + std::to_string(conn.outstanding.size()) +
+                                             " tasks outstanding");
+        for (std::size_t task : conn.outstanding) {
+            ShardResult& result = results[task];
+            if (result.attempts >= options.maxAttempts) {
+                result.error = "given up after " + std::to_string(result.attempts) + " workers dropped it";
+                settle(result);
+            } else {
+                pending.push_front(task);
+            }
+        }
+        ::close(conn.fd);
+        connections.erase(std::find_if(connections.begin(), connections.end(),
+                                       [&conn](const std::unique_ptr<Connection>& c) { return c.get() == &conn; }));
+    }
+
+    // Tops every worker up to its thread count, preferring tasks on segments
+    // it already holds
+    void dispatch() {
+        for (auto& conn : connections) {
+            while (conn->ready && !pending.empty() && conn->outstanding.size() < conn->slots) {
+                auto pick = pending.begin();
+                for (auto it = pending.begin(); it != pending.end(); ++it) {
+                    if (conn->segments.count(results[*it].segment)) { pick = it; break; }
+                }
+                std::size_t task = *pick;
+                pending.erase(pick);
+                assign(*conn, task);
+            }
+        }
+    }
+
+    void assign(Connection& conn, std::size_t task) {
+        ShardResult& result = results[task];
+        const TraceSegment& segment = segments[result.segment];
+        if (conn.segments.insert(result.segment).second) {
+            std::string head;
+            WireWriter w(head);
+            w.varint(result.segment);
+            w.str(segment.name);
+            std::string framed;
+            frameHeader(framed, Message::Segment, head.size() + segment.trace->size());
+            conn.queue(framed + head);
+            conn.queue(segment.trace);
+        }
+        std::string payload;
+        WireWriter w(payload);
+        w.varint(task);
+        w.varint(result.segment);
+        w.str(configs[result.config]);
+        conn.queue(frame(Message::Task, payload));
+        conn.outstanding.insert(task);
+        ++result.attempts;
+    }
+};
+
+#endif
+
+}
+
+bool DistributedSweep::segmentTraces(const std::vector<std::string>& paths, std::size_t jobsPerSegment,
+                                     std::vector<TraceSegment>& into, std::string& error) {
+    for (const auto& path : paths) {
+        JobTable table;
+        if (!TraceFile::readJobs(path, table, error)) return false;
+        auto set = SharedJobSet::create(std::move(table));
+        const JobTable& jobs = set->table();
+        const std::vector<JobHandle>& order = set->arrivalOrder();
+        std::size_t step = jobsPerSegment > 0 ? jobsPerSegment : std::max<std::size_t>(1, order.size());
+        std::size_t index = 0;
+        for (std::size_t from = 0; from < order.size(); from += step, ++index) {
+            std::size_t to = std::min(order.size(), from + step);
+            JobTable part;
+            part.reserve(to - from);
+            for (std::size_t i = from; i < to; ++i) {
+                JobHandle h = order[i];
+                part.add(jobs.id(h), jobs.name(h), jobs.arrival(h), jobs.burst(h), jobs.priority(h), jobs.deadline(h));
+            }
+            auto bytes = std::make_shared<std::string>();
+            TraceFile::encodeJobs(part, *bytes);
+            TraceSegment segment;
+            segment.name = step < order.size() ? path + "#" + std::to_string(index) : path;
+            segment.jobs = to - from;
+            segment.trace = std::move(bytes);
+            into.push_back(std::move(segment));
+        }
+    }
+    return true;
+}
+
+bool DistributedSweep::coordinate(const std::vector<std::string>& configs, const std::vector<TraceSegment>& segments,
+                                  const CoordinatorOptions& options, std::vector<ShardResult>& results,
+                                  std::string& error) {
+    for (const auto& label : configs) {
+        SchedulerConfig config;
+        if (!ComparisonRunner::findConfig(label, config)) {
+            error = "unknown config '" + label + "'";
+            return false;
+        }
+    }
+#ifdef DISTRIBUTED_SWEEP_POSIX
+    Coordinator coordinator(configs, segments, options, results);
+    return coordinator.run(error);
+#else
+    error = "distributed sweeps need POSIX sockets";
+    return false;
+#endif
+}
+
+bool DistributedSweep::work(const std::string& host, std::uint16_t port, unsigned threads, std::string& error,
+                            const std::function<void(const std::string&)>& sink) {
+#ifdef DISTRIBUTED_SWEEP_POSIX
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* found = nullptr;
+    int status = ::getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &found);
+    if (status != 0) {
+        error = "cannot resolve " + host + ": " + ::gai_strerror(status);
+        return false;
+    }
+    int fd = -1;
+    for (addrinfo* a = found; a && fd < 0; a = a->ai_next) {
+        fd = ::socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+        if (fd >= 0 && ::connect(fd, a->ai_addr, a->ai_addrlen) < 0) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+    ::freeaddrinfo(found);
+    if (fd < 0) {
+        error = "cannot connect to " + host + ":" + std::to_string(port) + ": " + std::strerror(errno);
+        return false;
+    }
+    configureSocket(fd);
+
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    char name[256] = "worker";
+    ::gethostname(name, sizeof name - 1);
+    std::string hello;
+    WireWriter w(hello);
+    w.u32(kProtocolVersion);
+    w.varint(threads);
+    w.str(name);
+    std::mutex sendMutex;
+    auto send = [&](const std::string& bytes) {
+        std::lock_guard<std::mutex> lock(sendMutex);
+        return sendAll(fd, bytes.data(), bytes.size());
+    };
+    bool finished = false;
+    if (!send(frame(Message::Hello, hello))) {
+        error = "connection to the coordinator failed";
+        ::close(fd);
+        return false;
+    }
+    log(sink, "Connected to " + host + ":" + std::to_string(port) + " with " + std::to_string(threads) + " threads");
+
+    {
+        std::atomic<bool> cancel{ false };
+        // A segment that failed to decode keeps its error, for its tasks
+        struct Held {
+            std::string name;
+            std::shared_ptr<const SharedJobSet> jobs;
+            std::string error;
+        };
+        std::map<std::uint64_t, Held> held;
+        ThreadPool pool(threads);
+        Message type;
+        std::string payload;
+        while (readFrame(fd, type, payload)) {
+            WireReader in(payload);
+            if (type == Message::Shutdown) {
+                finished = true;
+                break;
+            }
+            if (type == Message::Segment) {
+                std::uint64_t id = in.varint();
+                Held segment;
+                segment.name = in.str();
+                std::string_view trace = in.view(in.remaining());
+                JobTable table;
+                if (!in.ok()) segment.error = "malformed segment";
+                else if (TraceFile::decodeJobs(trace, segment.name, table, segment.error))
+                    segment.jobs = SharedJobSet::create(std::move(table));
+                held[id] = std::move(segment);
+            } else if (type == Message::Forget) {
+                held.erase(in.varint());
+            } else if (type == Message::Task) {
+                std::uint64_t task = in.varint();
+                std::uint64_t id = in.varint();
+                std::string label = in.str();
+                if (!in.ok()) break;
+                auto segment = held.find(id);
+                std::string why;
+                SchedulerConfig config;
+                if (segment == held.end()) why = "segment " + std::to_string(id) + " was never sent";
+                else if (!segment->second.jobs) why = segment->second.error;
+                else if (!ComparisonRunner::findConfig(label, config)) why = "unknown config '" + label + "'";
+                if (!why.empty()) {
+                    std::string reply;
+                    WireWriter r(reply);
+                    r.varint(task);
+                    r.u8(0);
+                    r.str(why);
+                    send(frame(Message::Result, reply));
+                    continue;
+                }
+                pool.submit([&, task, config, jobs = segment->second.jobs, where = segment->second.name] {
+                    ComparisonOptions options;
+                    options.sketches = true;
+                    options.cancel = &cancel;
+                    ComparisonResult result = ComparisonRunner::runConfig(jobs, config, options);
+                    if (result.cancelled) return;
+                    std::string reply;
+                    WireWriter r(reply);
+                    r.varint(task);
+                    r.u8(1);
+                    r.f64(result.wallMs);
+                    result.sketches->encode(r);
+                    send(frame(Message::Result, reply));
+                    log(sink, config.label + " on " + where + ": " + std::to_string((long long)result.wallMs) + " ms");
+                });
+            } else {
+                break;
+            }
+        }
+        // Whatever is still running is for a coordinator that has gone
+        if (!finished) cancel = true;
+    }
+    ::close(fd);
+    if (!finished) error = "lost the connection to the coordinator";
+    return finished;
+#else
+    (void)host; (void)port; (void)threads; (void)sink;
+    error = "distributed sweeps need POSIX sockets";
+    return false;
+#endif
+}
+
+std::vector<ComparisonResult> DistributedSweep::mergeByConfig(const std::vector<std::string>& configs,
+                                                              const std::vector<ShardResult>& results) {
+    std::vector<ComparisonResult> merged(configs.size());
+    std::vector<RunSketches> sketches(configs.size());
+    std::vector<std::size_t> finished(configs.size(), 0);
+    for (const auto& shard : results) {
+        if (!shard.done) continue;
+        sketches[shard.config].mergeShard(shard.sketches);
+        merged[shard.config].wallMs += shard.wallMs;
+        ++finished[shard.config];
+    }
+    for (std::size_t c = 0; c < configs.size(); ++c) {
+        merged[c].label = configs[c];
+        if (finished[c] == 0) {
+            merged[c].cancelled = true;
+            continue;
+        }
+        merged[c].stats = sketches[c].statistics();
+        merged[c].sketches = std::make_shared<RunSketches>(std::move(sketches[c]));
+    }
+    return merged;
+}
+
+bool DistributedSweep::writeCsv(const std::string& path, const std::vector<std::string>& configs,
+                                const std::vector<TraceSegment>& segments, const std::vector<ShardResult>& results,
+                                std::string& error) {
+    std::ofstream out(path);
+    if (!out) {
+        error = "cannot open " + path + " for writing";
+        return false;
+    }
+    out << "config,segment,jobs,status,worker,sim_ms,avg_wt,p50_wt,p95_wt,p99_wt,avg_tt,p99_tt,avg_rt,"
+           "throughput,cpu_utilization,makespan,deadline_miss_rate,error\n";
+    for (const auto& shard : results) {
+        out << quoted(configs[shard.config]) << ',' << quoted(segments[shard.segment].name) << ','
+            << segments[shard.segment].jobs << ',';
+        if (!shard.done) {
+            // The twelve metric columns stay empty
+            out << "failed," << quoted(shard.worker) << ",,,,,,,,,,,,," << quoted(shard.error) << '\n';
+            continue;
+        }
+        RunStatistics s = shard.sketches.statistics();
+        out << "done," << quoted(shard.worker) << ',' << shard.wallMs
+            << ',' << s.waiting.mean << ',' << s.waiting.p50 << ',' << s.waiting.p95 << ',' << s.waiting.p99
+            << ',' << s.turnaround.mean << ',' << s.turnaround.p99 << ',' << s.response.mean
+            << ',' << s.throughput << ',' << s.cpuUtilization << ',' << s.makespan << ',' << s.deadlineMissRate
+            << ",\n";
+    }
+    if (!out) {
+        error = "write to " + path + " failed";
+        return false;
+    }
+    return true;
+}
\ No newline at end of file
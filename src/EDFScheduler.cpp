@@ -0,0 +1,91 @@
+#include "../include/EDFScheduler.h"
+#include "../include/Statistics.h"
+#include <algorithm>
+#include <sstream>
+
+bool EDFScheduler::EarlierDeadline::operator()(JobHandle a, JobHandle b) const {
+    const JobTable& jobs = *owner->table;
+    // kNoDeadline sorts last once widened to unsigned
+    unsigned da = (unsigned)jobs.deadline(a), db = (unsigned)jobs.deadline(b);
+    if (da != db) return da < db;
+    if (jobs.arrival(a) != jobs.arrival(b)) return jobs.arrival(a) < jobs.arrival(b);
+    return a < b;
+}
+
+EDFScheduler::EDFScheduler(bool admissionControl)
+    : readyQueue(EarlierDeadline{ this }, runMemory()), admitted(runMemory()), rejected(runMemory()),
+      admissionControl(admissionControl) {}
+
+void EDFScheduler::enqueue(JobHandle job) {
+    if (job >= admitted.size()) admitted.resize(job + 1, 0);
+    if (!admitted[job]) {
+        if (admissionControl && !DeadlineAdmission::admit(job, readyQueue.items(), *table)) {
+            rejected.push_back(job);
+            return;
+        }
+        admitted[job] = 1;
+    }
+    readyQueue.push(job);
+}
+
+JobHandle EDFScheduler::dequeue() {
+    if (readyQueue.empty()) {
+        return kNoJob;
+    }
+    return readyQueue.pop();
+}
+
+bool EDFScheduler::hasJobs() const {
+    return !readyQueue.empty();
+}
+
+void EDFScheduler::schedule(int currentTime) {
+    // Deadlines are fixed, so the heap is always in order
+}
+
+std::vector<JobHandle> EDFScheduler::queuedJobs() const {
+    std::vector<JobHandle> queued(readyQueue.items().begin(), readyQueue.items().end());
+    std::sort(queued.begin(), queued.end(), EarlierDeadline{ this });
+    return queued;
+}
+
+void EDFScheduler::recycle(JobHandle job) {
+    if (job < admitted.size()) admitted[job] = 0;
+}
+
+void EDFScheduler::takeRejected(std::vector<JobHandle>& into) {
+    into.insert(into.end(), rejected.begin(), rejected.end());
+    rejected.clear();
+}
+
+EDFScheduler::~EDFScheduler() {}
+
+void EDFScheduler::attach(JobTable& jobs) {
+    readyQueue.release();
+    releaseStorage(admitted);
+    releaseStorage(rejected);
+    Scheduler::attach(jobs);
+}
+
+void EDFScheduler::setJobs(const std::vector<Job>& jobs) {
+    attach(ownTable);
+    attachGantt(ownGantt);
+    ownTable.clear();
+    for (const auto& job : jobs) {
+        enqueue(ownTable.add(job));
+    }
+}
+
+std::string EDFScheduler::getGanttChart() const {
+    return gantt->render(*table);
+}
+
+std::string EDFScheduler::getTimelineLog() const {
+    return events->format(*table);
+}
+
+std::string EDFScheduler::getStatistics() const {
+    std::string report = StatisticsEngine::report(*table, "EDF");
+    if (admissionControl) report += "Rejected at admission: " + std::to_string(rejected.size()) + "\n";
+    return report;
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include "../include/EventLog.h"
+#include "../include/OutputBuffer.h"
+#include <algorithm>
+
+namespace {
+
+constexpr std::size_t kChunkBytes = EventLog::kChunkEvents * sizeof(TimelineEvent);
+
+// Unnamed jobs (created from an id) are shown by id
+void appendName(OutputBuffer& out, const JobTable& jobs, JobHandle h) {
+    std::string_view name = jobs.name(h);
+    if (!name.empty()) {
+        out.append(name);
+    } else {
+        out.append('J');
+        out.appendInt(jobs.id(h));
+    }
+}
+
+}
+
+EventLog::EventLog(const EventLog& other, std::size_t n, std::pmr::memory_resource* memory)
+    : chunks(memory), on(other.on) {
+    n = std::min(n, other.count);
+    reserve(n);
+    for (std::size_t i = 0; i < n; ++i) chunks[i / kChunkEvents][i % kChunkEvents] = other[i];
+    count = n;
+}
+
+EventLog::EventLog(EventLog&& other, std::pmr::memory_resource* memory)
+    : EventLog(memory) {
+    if (other.chunks.get_allocator().resource() == memory) *this = std::move(other);
+    else *this = (const EventLog&)other;
+}
+
+EventLog::EventLog(EventLog&& other) noexcept
+    : chunks(std::move(other.chunks)), count(other.count), on(other.on) {
+    other.chunks.clear();
+    other.count = 0;
+}
+
+EventLog& EventLog::operator=(const EventLog& other) {
+    if (this == &other) return *this;
+    count = 0;
+    reserve(other.count);
+    for (std::size_t i = 0; i < other.count; ++i) chunks[i / kChunkEvents][i % kChunkEvents] = other[i];
+    count = other.count;
+    on = other.on;
+    return *this;
+}
+
+EventLog& EventLog::operator=(EventLog&& other) {
+    if (this == &other) return *this;
+    if (chunks.get_allocator() != other.chunks.get_allocator()) return *this = (const EventLog&)other;
+    freeChunks();
+    chunks.swap(other.chunks);
+    count = other.count;
+    on = other.on;
+    other.count = 0;
+    return *this;
+}
+
+EventLog::~EventLog() {
+    freeChunks();
+}
+
+void EventLog::addChunk() {
+    void* chunk = chunks.get_allocator().resource()->allocate(kChunkBytes, alignof(TimelineEvent));
+    chunks.push_back(static_cast<TimelineEvent*>(chunk));
+}
+
+void EventLog::freeChunks() {
+    std::pmr::memory_resource* memory = chunks.get_allocator().resource();
+    for (TimelineEvent* chunk : chunks) memory->deallocate(chunk, kChunkBytes, alignof(TimelineEvent));
+    chunks.clear();
+    count = 0;
+}
+
+void EventLog::reserve(std::size_t n) {
+    while (chunks.size() * kChunkEvents < n) addChunk();
+}
+
+char EventLog::symbol(EventType type) {
+    switch (type) {
+    case EventType::Arrive: return 'A';
+    case EventType::Start: return 'S';
+    case EventType::Preempt: return 'P';
+    case EventType::Resume: return 'R';
+    case EventType::Complete: return 'C';
+    }
+    return '?';
+}
+
+std::string EventLog::format(const JobTable& jobs) const {
+    // About 40 bytes a line
+    OutputBuffer out(count * 40 + 128);
+    out.append("Timeline Log:\n");
+#if !EVENT_LOG_ENABLED
+    out.append("(event recording was compiled out)\n");
+#endif
+    for (std::size_t i = 0; i < count; ++i) {
+        const TimelineEvent& event = (*this)[i];
+        out.appendIntRight(event.time, 8);
+        out.append("  [");
+        out.append(symbol(event.type));
+        out.append("] ");
+        appendName(out, jobs, event.job);
+        if (event.type == EventType::Complete) {
+            out.append("  (turnaround ");
+            out.appendInt(jobs.turnaround(event.job));
+            out.append(", waiting ");
+            out.appendInt(jobs.waiting(event.job));
+            out.append(')');
+        }
+        out.append('\n');
+    }
+    out.append("Legend: [A]=Arrival, [S]=Start, [P]=Preemption, [R]=Resume, [C]=Completion\n");
+    return out.take();
+}
\ No newline at end of file
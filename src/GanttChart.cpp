@@ -0,0 +1,17 @@
+#include "../include/GanttChart.h"
+#include "../include/GanttRenderer.h"
+
+void GanttChart::record(JobHandle job, int start, int length) {
+    if (length <= 0 || !on) return;
+    if (!runs.empty() && runs.back().job == job && runs.back().end() == start) {
+        runs.back().length += length;
+        return;
+    }
+    runs.push_back({ job, start, length });
+}
+
+std::string GanttChart::render(const JobTable& jobs) const {
+    OutputBuffer out;
+    GanttRenderer::renderText(*this, jobs, GanttView(), out);
+    return out.take();
+}
\ No newline at end of file
@@ -0,0 +1,502 @@
+#include "../include/GanttRenderer.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/ioctl.h>
+#include <unistd.h>
+#define GANTT_RENDERER_TTY 1
+#endif
+
+namespace {
+
+const char* const kColors[] = { "\033[41m", "\033[42m", "\033[43m", "\033[44m", "\033[45m", "\033[46m", "\033[47m" };
+const char* const kReset = "\033[0m";
+
+std::size_t digits(long long value) {
+    std::size_t n = value < 0 ? 2 : 1;
+    for (value = value < 0 ? -value : value; value >= 10; value /= 10) ++n;
+    return n;
+}
+
+// Unnamed jobs (created from an id) are shown by id
+std::size_t nameLength(const JobTable& jobs, JobHandle h) {
+    std::size_t n = jobs.name(h).size();
+    return n ? n : 1 + digits(jobs.id(h));
+}
+
+void appendName(OutputBuffer& out, const JobTable& jobs, JobHandle h) {
+    std::string_view name = jobs.name(h);
+    if (!name.empty()) {
+        out.append(name);
+    } else {
+        out.append('J');
+        out.appendInt(jobs.id(h));
+    }
+}
+
+// Names go into JSON strings and XML text as they are, apart from these
+void appendEscaped(OutputBuffer& out, const JobTable& jobs, JobHandle h, bool xml) {
+    std::string_view name = jobs.name(h);
+    if (name.empty()) {
+        appendName(out, jobs, h);
+        return;
+    }
+    for (char c : name) {
+        if (xml) {
+            if (c == '&') out.append("&amp;");
+            else if (c == '<') out.append("&lt;");
+            else if (c == '>') out.append("&gt;");
+            else if (c == '"') out.append("&quot;");
+            else out.append(c);
+        } else if (c == '"' || c == '\\') {
+            out.append('\\');
+            out.append(c);
+        } else if ((unsigned char)c < 0x20) {
+            out.append(' ');
+        } else {
+            out.append(c);
+        }
+    }
+}
+
+// Time range of the view, clipped to the segments of every lane
+bool extent(const std::vector<const GanttChart*>& lanes, const GanttView& view, long long& from, long long& to) {
+    long long first = std::numeric_limits<long long>::max(), last = std::numeric_limits<long long>::min();
+    for (const GanttChart* lane : lanes) {
+        if (!lane || lane->empty()) continue;
+        first = std::min(first, (long long)lane->segments().front().start);
+        last = std::max(last, (long long)lane->segments().back().end());
+    }
+    from = std::max(first, (long long)view.from);
+    to = std::min(last, (long long)view.to);
+    return from < to;
+}
+
+std::pmr::vector<GanttSegment>::const_iterator firstInView(const GanttChart& gantt, long long from) {
+    return std::partition_point(gantt.segments().begin(), gantt.segments().end(),
+                                [from](const GanttSegment& s) { return s.end() <= from; });
+}
+
+// One slice of time in a downsampled chart
+struct Column {
+    JobHandle job = kNoJob;     // most CPU time in the slice; kNoJob when idle
+    long long busy = 0;
+    bool mixed = false;         // several jobs, or idle part of the time
+};
+
+struct Columns {
+    long long from = 0;
+    long long scale = 1;        // time units per column
+    std::vector<Column> columns;
+    long long start(std::size_t c) const { return from + (long long)c * scale; }
+};
+
+// Splits [from, to) into at most `maxColumns` equal slices and reduces the
+// segments in each to its main job. Segments come in time order, so every
+// column is finished before the next one starts. Adds each job's time in
+// view to `perJob` when given.
+Columns downsample(const GanttChart& gantt, long long from, long long to, long long maxColumns,
+                   std::vector<long long>* perJob) {
+    Columns result;
+    result.from = from;
+    long long span = to - from;
+    result.scale = std::max(1LL, (span + maxColumns - 1) / std::max(1LL, maxColumns));
+    result.columns.resize((std::size_t)((span + result.scale - 1) / result.scale));
+
+    std::vector<std::pair<JobHandle, long long>> shares;   // the open column's, by job
+    std::size_t open = 0;
+    auto close = [&] {
+        if (shares.empty()) return;
+        Column& column = result.columns[open];
+        std::sort(shares.begin(), shares.end());
+        long long best = 0;
+        std::size_t distinct = 0;
+        for (std::size_t i = 0; i < shares.size();) {
+            JobHandle job = shares[i].first;
+            long long time = 0;
+            for (; i < shares.size() && shares[i].first == job; ++i) time += shares[i].second;
+            ++distinct;
+            if (time > best) {
+                best = time;
+                column.job = job;
+            }
+        }
+        long long width = std::min(to, result.start(open + 1)) - result.start(open);
+        column.mixed = distinct > 1 || column.busy < width;
+        shares.clear();
+    };
+
+    const auto& segments = gantt.segments();
+    for (auto it = firstInView(gantt, from); it != segments.end() && it->start < to; ++it) {
+        long long a = std::max<long long>(it->start, from), b = std::min<long long>(it->end(), to);
+        if (perJob) (*perJob)[it->job] += b - a;
+        while (a < b) {
+            std::size_t c = (std::size_t)((a - from) / result.scale);
+            if (c != open) {
+                close();
+                open = c;
+            }
+            long long piece = std::min(b, result.start(c + 1)) - a;
+            result.columns[c].busy += piece;
+            if (!shares.empty() && shares.back().first == it->job) shares.back().second += piece;
+            else shares.emplace_back(it->job, piece);
+            a += piece;
+        }
+    }
+    close();
+    return result;
+}
+
+// Width of the segment-per-cell layout, or 0 once it passes `budget`
+std::size_t detailedWidth(const GanttChart& gantt, const JobTable& jobs, long long from, long long to,
+                          std::size_t budget) {
+    auto begin = firstInView(gantt, from);
+    std::size_t width = 8;
+    long long time = std::max<long long>(begin->start, from);
+    for (auto it = begin; it != gantt.segments().end() && it->start < to; ++it) {
+        long long start = std::max<long long>(it->start, from);
+        if (start > time) width += std::max<std::size_t>(4, digits(time) + 1);
+        width += std::max(nameLength(jobs, it->job) + 2, digits(start)) + 1;
+        if (width > budget) return 0;
+        time = std::min<long long>(it->end(), to);
+    }
+    return width;
+}
+
+void renderDetailed(const GanttChart& gantt, const JobTable& jobs, long long from, long long to,
+                    const GanttView& view, std::size_t width, OutputBuffer& out) {
+    const auto& segments = gantt.segments();
+    auto begin = firstInView(gantt, from);
+    long long time;
+
+    // Each cell is wide enough for its label and the start time above it
+    OutputBuffer times(width + 32), bar(width + 16 * (std::size_t)(segments.end() - begin));
+    times.append("Time:   ");
+    bar.append("        ");
+    std::vector<bool> labelled(jobs.size(), false);
+    std::vector<JobHandle> order;
+    time = std::max<long long>(begin->start, from);
+    for (auto it = begin; it != segments.end() && it->start < to; ++it) {
+        long long start = std::max<long long>(it->start, from);
+        if (start > time) {
+            std::size_t cell = std::max<std::size_t>(4, digits(time) + 1);
+            times.appendIntLeft(time, cell);
+            bar.appendLeft(" --", cell);
+        }
+        std::size_t label = nameLength(jobs, it->job) + 2;
+        std::size_t cell = std::max(label, digits(start)) + 1;
+        times.appendIntLeft(start, cell);
+        if (view.color) bar.append(kColors[it->job % 7]);
+        bar.append(' ');
+        appendName(bar, jobs, it->job);
+        bar.append(' ');
+        if (view.color) bar.append(kReset);
+        bar.repeat(' ', cell - label);
+        time = std::min<long long>(it->end(), to);
+        if (!labelled[it->job]) {
+            labelled[it->job] = true;
+            order.push_back(it->job);
+        }
+    }
+    times.appendInt(time);
+    out.append(times.str());
+    out.append('\n');
+    out.append(bar.str());
+    out.append('\n');
+
+    out.append("Labels: ");
+    for (JobHandle job : order) {
+        out.append('[');
+        appendName(out, jobs, job);
+        out.append(":A=");
+        out.appendInt(jobs.arrival(job));
+        out.append(",B=");
+        out.appendInt(jobs.burst(job));
+        out.append("] ");
+    }
+    out.append('\n');
+}
+
+void renderColumns(const GanttChart& gantt, const JobTable& jobs, long long from, long long to,
+                   const GanttView& view, int width, OutputBuffer& out) {
+    std::vector<long long> perJob(jobs.size(), 0);
+    Columns slices = downsample(gantt, from, to, std::max(10, width - 8), &perJob);
+    std::size_t n = slices.columns.size();
+
+    out.append("time ");
+    out.appendInt(from);
+    out.append(" to ");
+    out.appendInt(to);
+    out.append(", 1 column = ");
+    out.appendInt(slices.scale);
+    out.append(slices.scale == 1 ? " time unit\n" : " time units\n");
+
+    // A start time every ten columns, where the previous one leaves room
+    std::string axis(n + 24, ' ');
+    std::size_t free = 0;
+    for (std::size_t c = 0; c < n; c += 10) {
+        if (c < free) continue;
+        std::string label = std::to_string(slices.start(c));
+        axis.replace(c, label.size(), label);
+        free = c + label.size() + 1;
+    }
+    axis.erase(axis.find_last_not_of(' ') + 1);
+    out.append("Time:   ");
+    out.append(axis);
+    out.append('\n');
+
+    out.append("        ");
+    const char* current = nullptr;
+    for (const Column& column : slices.columns) {
+        const char* color = column.job == kNoJob || !view.color ? nullptr : kColors[column.job % 7];
+        if (color != current) {
+            out.append(color ? color : kReset);
+            current = color;
+        }
+        if (column.job == kNoJob) out.append('-');
+        else if (column.mixed) out.append(':');
+        else out.append(view.color ? ' ' : '#');
+    }
+    if (current) out.append(kReset);
+    out.append('\n');
+    out.append(view.color ? "Key: color = job with the most CPU time in the column; ' ' that job throughout, "
+                          : "Key: '#' one job throughout, ");
+    out.append("':' several jobs or partly idle, '-' idle\n");
+
+    // The few jobs with the most CPU time in view
+    std::vector<JobHandle> top;
+    for (JobHandle job = 0; job < (JobHandle)perJob.size(); ++job)
+        if (perJob[job] > 0) top.push_back(job);
+    std::size_t shown = std::min<std::size_t>(5, top.size());
+    std::partial_sort(top.begin(), top.begin() + shown, top.end(),
+                      [&perJob](JobHandle a, JobHandle b) { return perJob[a] > perJob[b]; });
+    out.append("Most CPU time: ");
+    for (std::size_t i = 0; i < shown; ++i) {
+        if (i) out.append(", ");
+        appendName(out, jobs, top[i]);
+        out.append(' ');
+        out.appendInt(perJob[top[i]]);
+    }
+    out.append(" (");
+    out.appendInt((long long)top.size());
+    out.append(" jobs ran)\n");
+}
+
+int hue(const JobTable& jobs, JobHandle job) {
+    return (int)(((std::uint32_t)jobs.id(job) * 137u) % 360u);
+}
+
+}
+
+void GanttRenderer::renderText(const GanttChart& gantt, const JobTable& jobs, const GanttView& view, OutputBuffer& out) {
+    out.append("Gantt Chart:");
+    long long from, to;
+    if (!extent({ &gantt }, view, from, to)) {
+        out.append('\n');
+        return;
+    }
+    int width = view.width > 0 ? view.width : terminalWidth();
+    std::size_t budget = (std::size_t)std::max(width, 40) * kDetailedLines;
+    if (std::size_t detailed = detailedWidth(gantt, jobs, from, to, budget)) {
+        out.append('\n');
+        renderDetailed(gantt, jobs, from, to, view, detailed, out);
+        return;
+    }
+    auto begin = firstInView(gantt, from);
+    auto end = std::partition_point(begin, gantt.segments().end(), [to](const GanttSegment& s) { return s.start < to; });
+    out.append(' ');
+    out.appendInt((long long)(end - begin));
+    out.append(" segments, ");
+    renderColumns(gantt, jobs, from, to, view, width, out);
+}
+
+void GanttRenderer::print(const GanttChart& gantt, const JobTable& jobs, const GanttView& view) {
+    OutputBuffer out;
+    renderText(gantt, jobs, view, out);
+    out.writeToStdout();
+}
+
+bool GanttRenderer::writeChromeTrace(const std::string& path, const std::vector<const GanttChart*>& lanes,
+                                     const JobTable& jobs, std::string& error, const EventLog* events) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        error = "cannot open '" + path + "' for writing: " + std::strerror(errno);
+        return false;
+    }
+    bool written;
+    {
+        OutputBuffer out(file);
+        out.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        bool first = true;
+        auto separate = [&] {
+            if (!first) out.append(",\n");
+            first = false;
+        };
+        auto thread = [&](std::size_t tid, const char* name, long long number) {
+            separate();
+            out.append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":");
+            out.appendInt((long long)tid);
+            out.append(",\"args\":{\"name\":\"");
+            out.append(name);
+            if (number >= 0) {
+                out.append(' ');
+                out.appendInt(number);
+            }
+            out.append("\"}}");
+        };
+        for (std::size_t lane = 0; lane < lanes.size(); ++lane) {
+            thread(lane, "CPU", lanes.size() > 1 ? (long long)lane : -1);
+            if (!lanes[lane]) continue;
+            for (const GanttSegment& segment : lanes[lane]->segments()) {
+                separate();
+                out.append("{\"name\":\"");
+                appendEscaped(out, jobs, segment.job, false);
+                out.append("\",\"ph\":\"X\",\"pid\":1,\"tid\":");
+                out.appendInt((long long)lane);
+                out.append(",\"ts\":");
+                out.appendInt(segment.start);
+                out.append(",\"dur\":");
+                out.appendInt(segment.length);
+                out.append('}');
+            }
+        }
+        if (events && !events->empty()) {
+            static const char* const kinds[] = { "arrival", "start", "preemption", "resume", "completion" };
+            thread(lanes.size(), "Events", -1);
+            for (std::size_t i = 0; i < events->size(); ++i) {
+                const TimelineEvent& event = (*events)[i];
+                separate();
+                out.append("{\"name\":\"");
+                appendEscaped(out, jobs, event.job, false);
+                out.append(' ');
+                out.append(kinds[std::min<std::size_t>((std::size_t)event.type, 4)]);
+                out.append("\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":");
+                out.appendInt((long long)lanes.size());
+                out.append(",\"ts\":");
+                out.appendInt(event.time);
+                out.append('}');
+            }
+        }
+        out.append("\n]}\n");
+        written = out.flush();
+    }
+    if (std::fclose(file) != 0 || !written) {
+        error = "write to '" + path + "' failed";
+        return false;
+    }
+    return true;
+}
+
+bool GanttRenderer::writeSvg(const std::string& path, const std::vector<const GanttChart*>& lanes,
+                             const JobTable& jobs, const GanttView& view, std::string& error) {
+    const int left = 70, right = 10, top = 10, laneHeight = 22, barHeight = 18;
+    int width = view.width > 0 ? std::max(view.width, left + right + 100) : 1200;
+    int plot = width - left - right;
+    int height = top + laneHeight * (int)lanes.size() + 30;
+    long long from = 0, to = 0;
+    bool any = extent(lanes, view, from, to);
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        error = "cannot open '" + path + "' for writing: " + std::strerror(errno);
+        return false;
+    }
+    bool written;
+    {
+        OutputBuffer out(file);
+        out.append("<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"");
+        out.appendInt(width);
+        out.append("\" height=\"");
+        out.appendInt(height);
+        out.append("\" font-family=\"monospace\" font-size=\"11\">\n<rect width=\"100%\" height=\"100%\" fill=\"#fff\"/>\n");
+        for (std::size_t lane = 0; lane < lanes.size(); ++lane) {
+            int y = top + laneHeight * (int)lane;
+            out.append("<text x=\"4\" y=\"");
+            out.appendInt(y + 13);
+            out.append("\">CPU");
+            if (lanes.size() > 1) {
+                out.append(' ');
+                out.appendInt((long long)lane);
+            }
+            out.append("</text>\n");
+            if (!any || !lanes[lane]) continue;
+            Columns slices = downsample(*lanes[lane], from, to, plot, nullptr);
+            std::size_t n = slices.columns.size();
+            auto x = [&](std::size_t c) { return left + (long long)c * plot / (long long)n; };
+            for (std::size_t c = 0; c < n;) {
+                const Column& column = slices.columns[c];
+                std::size_t end = c + 1;
+                while (end < n && slices.columns[end].job == column.job && slices.columns[end].mixed == column.mixed) ++end;
+                if (column.job != kNoJob) {
+                    out.append("<rect x=\"");
+                    out.appendInt(x(c));
+                    out.append("\" y=\"");
+                    out.appendInt(y);
+                    out.append("\" width=\"");
+                    out.appendInt(std::max(1LL, x(end) - x(c)));
+                    out.append("\" height=\"");
+                    out.appendInt(barHeight);
+                    out.append("\" fill=\"hsl(");
+                    out.appendInt(hue(jobs, column.job));
+                    out.append(",65%,55%)\"");
+                    if (column.mixed) out.append(" fill-opacity=\"0.55\"");
+                    out.append("><title>");
+                    if (column.mixed) out.append("mostly ");
+                    appendEscaped(out, jobs, column.job, true);
+                    out.append(" [");
+                    out.appendInt(slices.start(c));
+                    out.append(", ");
+                    out.appendInt(std::min(to, slices.start(end)));
+                    out.append(")</title></rect>\n");
+                }
+                c = end;
+            }
+        }
+        // Time axis with a tick about every 100 px
+        int y = top + laneHeight * (int)lanes.size() + 4;
+        out.append("<line x1=\"");
+        out.appendInt(left);
+        out.append("\" y1=\"");
+        out.appendInt(y);
+        out.append("\" x2=\"");
+        out.appendInt(left + plot);
+        out.append("\" y2=\"");
+        out.appendInt(y);
+        out.append("\" stroke=\"#000\"/>\n");
+        long long labelled = from - 1;
+        for (int px = 0; any && px <= plot - 40; px += 100) {
+            long long time = from + (to - from) * px / plot;
+            if (time == labelled) continue;
+            labelled = time;
+            out.append("<text x=\"");
+            out.appendInt(left + (time - from) * plot / (to - from));
+            out.append("\" y=\"");
+            out.appendInt(y + 14);
+            out.append("\">");
+            out.appendInt(time);
+            out.append("</text>\n");
+        }
+        out.append("</svg>\n");
+        written = out.flush();
+    }
+    if (std::fclose(file) != 0 || !written) {
+        error = "write to '" + path + "' failed";
+        return false;
+    }
+    return true;
+}
+
+int GanttRenderer::terminalWidth() {
+#ifdef GANTT_RENDERER_TTY
+    struct winsize size;
+    if (::ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0 && size.ws_col > 0) return size.ws_col;
+#endif
+    if (const char* columns = std::getenv("COLUMNS")) {
+        int n = std::atoi(columns);
+        if (n > 0) return n;
+    }
+    return 80;
+}
\ No newline at end of file
@@ -0,0 +1,250 @@
+#include "../include/IncrementalSimulator.h"
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+namespace {
+
+// Past this many marks every other one goes and the interval doubles
+constexpr std::size_t kMaxMarks = 512;
+
+// Same inputs; results never enter into it
+bool sameJob(const JobTable& table, JobHandle h, const Job& job) {
+    return table.id(h) == job.jobId && table.arrival(h) == job.arrivalTime && table.burst(h) == job.burstTime &&
+           table.priority(h) == job.priority && table.deadline(h) == job.deadline && table.name(h) == job.name;
+}
+
+// One past the last arrival position taken by a job from [begin, end); a
+// set built from a job list numbers its jobs in list order
+std::size_t positionsPast(const SharedJobSet& set, std::size_t begin, std::size_t end) {
+    const auto& order = set.arrivalOrder();
+    std::size_t past = 0;
+    for (std::size_t pos = 0; pos < order.size(); ++pos)
+        if (order[pos] >= begin && order[pos] < end) past = pos + 1;
+    return past;
+}
+
+}
+
+IncrementalSimulator::IncrementalSimulator(SchedulerMaker make, long long markInterval)
+    : make(std::move(make)), requestedInterval(markInterval) {}
+
+void IncrementalSimulator::reset() {
+    current.reset();
+    jobSet.reset();
+    marks.clear();
+    markedQueue = 0;
+    last = IncrementalUpdate();
+}
+
+const Simulator* IncrementalSimulator::update(const std::vector<Job>& jobs) {
+    last = IncrementalUpdate();
+    Edit edit;
+    if (current) {
+        // The edit is whatever lies between the longest common prefix and suffix
+        const JobTable& old = jobSet->table();
+        std::size_t n = old.size(), m = jobs.size(), begin = 0, tail = 0;
+        while (begin < n && begin < m && sameJob(old, begin, jobs[begin])) ++begin;
+        if (begin == n && begin == m) return current.get();
+        while (tail < n - begin && tail < m - begin && sameJob(old, n - 1 - tail, jobs[m - 1 - tail])) ++tail;
+        edit.begin = begin;
+        edit.oldEnd = n - tail;
+        edit.newEnd = m - tail;
+    }
+    last.changed = true;
+    auto scheduler = make();
+    if (!scheduler) {
+        reset();
+        return nullptr;
+    }
+    std::shared_ptr<const SharedJobSet> next;
+    if (current) {
+        // The unchanged stretches come over from the last set in bulk
+        JobTable table(jobSet->table(), edit.begin, std::pmr::get_default_resource());
+        for (std::size_t i = edit.begin; i < edit.newEnd; ++i) {
+            const Job& job = jobs[i];
+            table.add(job.jobId, job.name, job.arrivalTime, job.burstTime, job.priority, job.deadline);
+        }
+        table.append(jobSet->table(), edit.oldEnd);
+        next = SharedJobSet::create(std::move(table));
+    } else {
+        next = SharedJobSet::create(jobs);
+    }
+
+    // Nothing before the earliest arrival the edit touches can differ, and a
+    // mark has admitted only jobs that arrived no later than its time
+    bool incremental = current && scheduler->resumesFromQueue();
+    std::size_t oldMark = 0;
+    if (incremental) {
+        edit.earliestArrival = std::numeric_limits<int>::max();
+        for (std::size_t i = edit.begin; i < edit.oldEnd; ++i)
+            edit.earliestArrival = std::min(edit.earliestArrival, jobSet->table().arrival(i));
+        for (std::size_t i = edit.begin; i < edit.newEnd; ++i)
+            edit.earliestArrival = std::min(edit.earliestArrival, jobs[i].arrivalTime);
+        edit.oldAdmitted = positionsPast(*jobSet, edit.begin, edit.oldEnd);
+        edit.newAdmitted = positionsPast(*next, edit.begin, edit.newEnd);
+        oldMark = std::lower_bound(marks.begin(), marks.end(), edit.earliestArrival,
+                                   [](const SimulatorMark& mark, int time) { return mark.time < time; }) - marks.begin();
+    }
+
+    std::vector<SimulatorMark> kept;
+    std::unique_ptr<Simulator> sim;
+    if (oldMark > 0) {
+        sim = std::make_unique<Simulator>(std::move(scheduler), next, current->checkpointAt(marks[oldMark - 1]));
+        last.resumed = true;
+        last.resumedAt = sim->getCurrentTime();
+        // Marks up to the resume point hold for the new set as they are
+        kept.assign(std::make_move_iterator(marks.begin()), std::make_move_iterator(marks.begin() + oldMark));
+        markedQueue = 0;
+        for (const auto& mark : kept) markedQueue += mark.queued.size();
+    } else {
+        sim = std::make_unique<Simulator>(std::move(scheduler), std::make_unique<SharedArrivalSource>(next));
+        interval = requestedInterval > 0 ? requestedInterval : std::max<long long>(1024, jobs.size() / 256);
+        markedQueue = 0;
+    }
+    bool marking = sim->getScheduler().resumesFromQueue();
+    if (marking && oldMark == 0) addMark(kept, sim->mark(), jobs.size());
+
+    long long sinceMark = 0;
+    while (true) {
+        if (incremental) {
+            int now = sim->getCurrentTime();
+            while (oldMark < marks.size() && marks[oldMark].time < now) ++oldMark;
+            if (oldMark < marks.size() && marks[oldMark].time == now) {
+                SimulatorMark here = sim->mark();
+                for (std::size_t k = oldMark; k < marks.size() && marks[k].time == now; ++k) {
+                    if (!matches(here, marks[k], edit, *next)) continue;
+                    auto fresh = make();
+                    if (!fresh) break;
+                    current = splice(std::move(fresh), *sim, here, k, next, kept);
+                    last.convergedAt = now;
+                    marks = std::move(kept);
+                    jobSet = std::move(next);
+                    return current.get();
+                }
+            }
+        }
+        if (!sim->step()) break;
+        ++last.steps;
+        if (marking && ++sinceMark >= interval) {
+            addMark(kept, sim->mark(), jobs.size());
+            sinceMark = 0;
+        }
+    }
+    current = std::move(sim);
+    marks = std::move(kept);
+    jobSet = std::move(next);
+    return current.get();
+}
+
+void IncrementalSimulator::addMark(std::vector<SimulatorMark>& into, SimulatorMark mark, std::size_t jobs) {
+    markedQueue += mark.queued.size();
+    into.push_back(std::move(mark));
+    // Bounded in number and in the queued handles they hold together, so a
+    // run with a long queue keeps fewer of them
+    if (into.size() <= kMaxMarks && markedQueue <= 4 * jobs + 65536) return;
+    std::size_t kept = 0;
+    markedQueue = 0;
+    for (std::size_t i = 0; i < into.size(); i += 2) {
+        markedQueue += into[i].queued.size();
+        into[kept++] = std::move(into[i]);
+    }
+    into.resize(kept);
+    interval *= 2;
+}
+
+bool IncrementalSimulator::matches(const SimulatorMark& now, const SimulatorMark& old, const Edit& edit,
+                                   const SharedJobSet& next) const {
+    if (now.time != old.time || now.queued.size() != old.queued.size()) return false;
+    // Every edited job admitted in both runs, and as many of the others
+    if (old.admitted < edit.oldAdmitted || now.admitted < edit.newAdmitted) return false;
+    if (old.admitted - (edit.oldEnd - edit.begin) != now.admitted - (edit.newEnd - edit.begin)) return false;
+    const auto& oldOrder = jobSet->arrivalOrder();
+    const auto& newOrder = next.arrivalOrder();
+    // Handles of the two runs name the same unchanged job
+    auto same = [&](JobHandle a, JobHandle b) {
+        if (a == kNoJob || b == kNoJob) return a == b;
+        std::size_t index = oldOrder[a];
+        if (index >= edit.begin && index < edit.oldEnd) return false;
+        if (index >= edit.oldEnd) index = index - edit.oldEnd + edit.newEnd;
+        return newOrder[b] == index;
+    };
+    if (!same(old.preempted, now.preempted)) return false;
+    // Start times only decide Start over Resume from here on
+    for (std::size_t i = 0; i < old.queued.size(); ++i) {
+        if (!same(old.queued[i], now.queued[i]) || old.queuedRemaining[i] != now.queuedRemaining[i] ||
+            (old.queuedStart[i] < 0) != (now.queuedStart[i] < 0))
+            return false;
+    }
+    return true;
+}
+
+std::unique_ptr<Simulator> IncrementalSimulator::splice(std::unique_ptr<Scheduler> scheduler, Simulator& sim,
+                                                        const SimulatorMark& now, std::size_t oldMark,
+                                                        std::shared_ptr<const SharedJobSet> next,
+                                                        std::vector<SimulatorMark>& into) {
+    const SimulatorMark& old = marks[oldMark];
+    const Simulator& before = *current;
+    const JobTable& oldJobs = before.getJobTable();
+    // Jobs queued at the join pair up by position; jobs admitted after it
+    // come in the same order in both runs
+    std::vector<std::pair<JobHandle, JobHandle>> queued(old.queued.size());
+    for (std::size_t i = 0; i < queued.size(); ++i) queued[i] = { old.queued[i], now.queued[i] };
+    std::sort(queued.begin(), queued.end());
+    auto toNew = [&](JobHandle h) -> JobHandle {
+        if (h == kNoJob) return kNoJob;
+        if (h >= old.admitted) return (JobHandle)(h - old.admitted + now.admitted);
+        return std::lower_bound(queued.begin(), queued.end(), std::make_pair(h, JobHandle(0)))->second;
+    };
+
+    SimulatorCheckpoint cp = sim.releaseCheckpoint();
+    for (const auto& [from, to] : queued) {
+        cp.jobs.setRemaining(to, oldJobs.remaining(from));
+        if (cp.jobs.start(to) < 0) cp.jobs.setStart(to, oldJobs.start(from));
+        cp.jobs.complete(to, oldJobs.completion(from));
+    }
+    cp.jobs.append(oldJobs, old.admitted);
+    // The segment running at the join may have carried on past it
+    const auto& segments = before.getGanttChart().segments();
+    if (old.segments > 0 && segments[old.segments - 1].length > old.lastSegmentLength) {
+        const GanttSegment& carried = segments[old.segments - 1];
+        cp.gantt.record(toNew(carried.job), carried.start + old.lastSegmentLength,
+                        carried.length - old.lastSegmentLength);
+    }
+    for (std::size_t i = old.segments; i < segments.size(); ++i)
+        cp.gantt.record(toNew(segments[i].job), segments[i].start, segments[i].length);
+    const EventLog& events = before.getEventLog();
+    for (std::size_t i = old.events; i < events.size(); ++i)
+        cp.events.record(events[i].time, toNew(events[i].job), events[i].type);
+    const auto& finished = before.getFinishedJobs();
+    for (std::size_t i = old.finished; i < finished.size(); ++i) cp.finished.push_back(toNew(finished[i]));
+    cp.time = before.getCurrentTime();
+    cp.queued.clear();
+    cp.preempted = kNoJob;
+
+    // The old marks past the join, in the new run's handles and column sizes
+    addMark(into, now, cp.jobs.size());
+    for (std::size_t k = oldMark + 1; k < marks.size(); ++k) {
+        SimulatorMark mark = std::move(marks[k]);
+        mark.admitted = mark.admitted - old.admitted + now.admitted;
+        // Segments merge across the join, so the chart position is read off
+        // the spliced chart: what had started by the mark, cut off there
+        const auto& spliced = cp.gantt.segments();
+        auto past = std::partition_point(spliced.begin(), spliced.end(),
+                                         [&](const GanttSegment& s) { return s.start < mark.time; });
+        mark.segments = past - spliced.begin();
+        mark.lastSegmentLength = mark.segments == 0 ? 0 : std::min(past[-1].end(), mark.time) - past[-1].start;
+        mark.events = mark.events - old.events + now.events;
+        mark.finished = mark.finished - old.finished + now.finished;
+        // A job queued at the join may have started at another time in
+        // this run, and a resume from the mark restores its start
+        for (std::size_t i = 0; i < mark.queued.size(); ++i) {
+            mark.queued[i] = toNew(mark.queued[i]);
+            if (mark.queuedStart[i] >= 0) mark.queuedStart[i] = cp.jobs.start(mark.queued[i]);
+        }
+        mark.preempted = toNew(mark.preempted);
+        addMark(into, std::move(mark), cp.jobs.size());
+    }
+    return std::make_unique<Simulator>(std::move(scheduler), std::move(next), std::move(cp));
+}
\ No newline at end of file
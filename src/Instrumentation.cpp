@@ -0,0 +1,61 @@
+#include "../include/Instrumentation.h"
+#include <iomanip>
+#include <sstream>
+
+const char* Instrumentation::phaseName(Phase phase) {
+    switch (phase) {
+    case Phase::Admission: return "admission";
+    case Phase::Enqueue: return "enqueue";
+    case Phase::Dequeue: return "dequeue";
+    case Phase::HasJobs: return "has_jobs";
+    case Phase::Schedule: return "schedule";
+    case Phase::TimeSlice: return "time_slice";
+    case Phase::Bookkeeping: return "bookkeeping";
+    case Phase::Aging: return "aging";
+    case Phase::Count: break;
+    }
+    return "";
+}
+
+std::string Instrumentation::format(const RunCounters& c) {
+    std::ostringstream oss;
+    oss << "=== Instrumentation ===\n";
+    if (!kEnabled) {
+        oss << "Not compiled in; rebuild with -DINSTRUMENTATION_ENABLED=1.\n";
+        return oss.str();
+    }
+    std::uint64_t total = 0;
+    for (std::size_t p = 0; p < RunCounters::kPhases; ++p)
+        if ((Phase)p != Phase::Aging) total += c.cycles[p];
+    oss << std::left << std::setw(14) << "Phase" << std::right << std::setw(16) << "Cycles"
+        << std::setw(8) << "Share" << std::setw(12) << "Calls" << std::setw(12) << "Cyc/call" << "\n";
+    oss << std::fixed << std::setprecision(1);
+    for (std::size_t p = 0; p < RunCounters::kPhases; ++p) {
+        oss << std::left << std::setw(14) << phaseName((Phase)p) << std::right << std::setw(16) << c.cycles[p]
+            << std::setw(7) << (total ? 100.0 * c.cycles[p] / total : 0.0) << "%"
+            << std::setw(12) << c.calls[p]
+            << std::setw(12) << (c.calls[p] ? (double)c.cycles[p] / c.calls[p] : 0.0) << "\n";
+    }
+    oss << "(aging runs inside schedule and is left out of the shares)\n";
+    oss << "Dispatches: " << c.dispatches << ", context switches: " << c.contextSwitches
+        << ", preemptions: " << c.preemptions << ", idle jumps: " << c.idleJumps << "\n";
+    oss << "Arrivals: " << c.arrivals << ", completions: " << c.completions
+        << ", queue high-water mark: " << c.queueHighWater << "\n";
+    oss << "Allocations: " << c.allocations << " (" << c.allocatedBytes << " bytes)\n";
+    return oss.str();
+}
+
+std::string Instrumentation::toJson(const RunCounters& c) {
+    std::ostringstream oss;
+    oss << "{\"enabled\": " << (kEnabled ? "true" : "false") << ", \"phases\": {";
+    for (std::size_t p = 0; p < RunCounters::kPhases; ++p) {
+        oss << (p ? ", " : "") << "\"" << phaseName((Phase)p) << "\": {\"cycles\": " << c.cycles[p]
+            << ", \"calls\": " << c.calls[p] << "}";
+    }
+    oss << "}, \"dispatches\": " << c.dispatches << ", \"context_switches\": " << c.contextSwitches
+        << ", \"preemptions\": " << c.preemptions << ", \"idle_jumps\": " << c.idleJumps
+        << ", \"arrivals\": " << c.arrivals << ", \"completions\": " << c.completions
+        << ", \"queue_high_water\": " << c.queueHighWater << ", \"allocations\": " << c.allocations
+        << ", \"allocated_bytes\": " << c.allocatedBytes << "}";
+    return oss.str();
+}
\ No newline at end of file
@@ -1,12 +1,13 @@
 #include "../include/Job.h"
+#include <sstream>
 
-Job::Job(int id, int arrival, int burst, int prio)
-    : jobId(id), arrivalTime(arrival), burstTime(burst), priority(prio),
+Job::Job(int id, int arrival, int burst, int prio, int deadline)
+    : jobId(id), arrivalTime(arrival), burstTime(burst), priority(prio), deadline(deadline),
       remainingTime(burst), startTime(-1), completionTime(-1),
       waitingTime(0), turnaroundTime(0) {}
 
-Job::Job(const std::string& name, int arrival, int burst, int prio)
-    : jobId(-1), name(name), arrivalTime(arrival), burstTime(burst), priority(prio),
+Job::Job(const std::string& name, int arrival, int burst, int prio, int deadline)
+    : jobId(-1), name(name), arrivalTime(arrival), burstTime(burst), priority(prio), deadline(deadline),
       remainingTime(burst), startTime(-1), completionTime(-1),
       waitingTime(0), turnaroundTime(0) {}
 
@@ -20,10 +21,39 @@ void Job::display() const {
               << " | Job ID: " << jobId
               << " | Arrival: " << arrivalTime
               << " | Burst: " << burstTime
-              << " | Priority: " << priority
-              << " | Start: " << startTime
+              << " | Priority: " << priority;
+    if (hasDeadline()) std::cout << " | Deadline: " << deadline;
+    std::cout << " | Start: " << startTime
               << " | Completion: " << completionTime
               << " | Waiting: " << waitingTime
               << " | Turnaround: " << turnaroundTime
               << std::endl;
+}
+
+std::string Job::serialize() const {
+    std::ostringstream oss;
+    oss << jobId << "," << name << "," << arrivalTime << "," << burstTime << "," << priority;
+    if (hasDeadline()) oss << "," << deadline;
+    return oss.str();
+}
+
+bool Job::deserialize(const std::string& line) {
+    std::istringstream ss(line);
+    std::string idField, nameField;
+    int arrival, burst, prio;
+    char comma;
+    if (!std::getline(ss, idField, ',') || !std::getline(ss, nameField, ',') ||
+        !(ss >> arrival >> comma >> burst >> comma >> prio))
+        return false;
+    int due = kNoDeadline;
+    if (ss >> comma && (comma != ',' || !(ss >> due))) return false;
+    int id;
+    try {
+        id = std::stoi(idField);
+    } catch (...) {
+        return false;
+    }
+    *this = Job(id, arrival, burst, prio, due);
+    name = nameField;
+    return true;
 }
\ No newline at end of file
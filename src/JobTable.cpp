@@ -0,0 +1,161 @@
+#include "../include/JobTable.h"
+
+JobTable::JobTable(std::pmr::memory_resource* memory)
+    : ids(memory), arrivals(memory), bursts(memory), priorities(memory), deadlines(memory),
+      remainings(memory), starts(memory), completions(memory), namePool(memory), nameOffsets(1, 0, memory) {}
+
+JobTable::JobTable(const JobTable& other, std::size_t n, std::pmr::memory_resource* memory)
+    : ids(other.ids.begin(), other.ids.begin() + n, memory),
+      arrivals(other.arrivals.begin(), other.arrivals.begin() + n, memory),
+      bursts(other.bursts.begin(), other.bursts.begin() + n, memory),
+      priorities(other.priorities.begin(), other.priorities.begin() + n, memory),
+      deadlines(other.deadlines.begin(), other.deadlines.begin() + n, memory),
+      remainings(other.remainings.begin(), other.remainings.begin() + n, memory),
+      starts(other.starts.begin(), other.starts.begin() + n, memory),
+      completions(other.completions.begin(), other.completions.begin() + n, memory),
+      namePool(other.namePool.begin(), other.namePool.begin() + other.nameOffsets[n], memory),
+      nameOffsets(other.nameOffsets.begin(), other.nameOffsets.begin() + n + 1, memory) {}
+
+JobTable::JobTable(JobTable&& other, std::pmr::memory_resource* memory)
+    : ids(std::move(other.ids), memory), arrivals(std::move(other.arrivals), memory),
+      bursts(std::move(other.bursts), memory), priorities(std::move(other.priorities), memory),
+      deadlines(std::move(other.deadlines), memory), remainings(std::move(other.remainings), memory),
+      starts(std::move(other.starts), memory), completions(std::move(other.completions), memory),
+      namePool(std::move(other.namePool), memory), nameOffsets(std::move(other.nameOffsets), memory) {}
+
+JobHandle JobTable::add(const Job& job) {
+    ids.push_back(job.jobId);
+    arrivals.push_back(job.arrivalTime);
+    bursts.push_back(job.burstTime);
+    priorities.push_back(job.priority);
+    deadlines.push_back(job.deadline);
+    remainings.push_back(job.remainingTime);
+    starts.push_back(job.startTime);
+    completions.push_back(job.completionTime);
+    namePool.insert(namePool.end(), job.name.begin(), job.name.end());
+    nameOffsets.push_back(namePool.size());
+    return (JobHandle)(ids.size() - 1);
+}
+
+JobHandle JobTable::add(int id, std::string_view name, int arrival, int burst, int priority, int deadline) {
+    ids.push_back(id);
+    arrivals.push_back(arrival);
+    bursts.push_back(burst);
+    priorities.push_back(priority);
+    deadlines.push_back(deadline);
+    remainings.push_back(burst);
+    starts.push_back(-1);
+    completions.push_back(-1);
+    namePool.insert(namePool.end(), name.begin(), name.end());
+    nameOffsets.push_back(namePool.size());
+    return (JobHandle)(ids.size() - 1);
+}
+
+void JobTable::reuse(JobHandle h, int id, int arrival, int burst, int priority, int deadline) {
+    ids[h] = id;
+    arrivals[h] = arrival;
+    bursts[h] = burst;
+    priorities[h] = priority;
+    deadlines[h] = deadline;
+    remainings[h] = burst;
+    starts[h] = -1;
+    completions[h] = -1;
+}
+
+void JobTable::appendColumns(std::size_t n, const std::int32_t* idCol, const std::int32_t* arrivalCol,
+                             const std::int32_t* burstCol, const std::int32_t* priorityCol,
+                             const std::int32_t* deadlineCol, const std::int32_t* remainingCol, const std::int32_t* startCol,
+                             const std::int32_t* completionCol,
+                             const char* names, const std::uint64_t* offsets) {
+    ids.insert(ids.end(), idCol, idCol + n);
+    arrivals.insert(arrivals.end(), arrivalCol, arrivalCol + n);
+    bursts.insert(bursts.end(), burstCol, burstCol + n);
+    priorities.insert(priorities.end(), priorityCol, priorityCol + n);
+    if (deadlineCol) deadlines.insert(deadlines.end(), deadlineCol, deadlineCol + n);
+    else deadlines.resize(deadlines.size() + n, kNoDeadline);
+    if (remainingCol) remainings.insert(remainings.end(), remainingCol, remainingCol + n);
+    else remainings.insert(remainings.end(), burstCol, burstCol + n);
+    if (startCol) starts.insert(starts.end(), startCol, startCol + n);
+    else starts.resize(starts.size() + n, -1);
+    if (completionCol) completions.insert(completions.end(), completionCol, completionCol + n);
+    else completions.resize(completions.size() + n, -1);
+    std::size_t base = namePool.size();
+    namePool.insert(namePool.end(), names + offsets[0], names + offsets[n]);
+    nameOffsets.reserve(nameOffsets.size() + n);
+    for (std::size_t i = 1; i <= n; ++i)
+        nameOffsets.push_back(base + (std::size_t)(offsets[i] - offsets[0]));
+}
+
+void JobTable::append(const JobTable& other, std::size_t from) {
+    auto tail = [from](auto& into, const auto& column) { into.insert(into.end(), column.begin() + from, column.end()); };
+    tail(ids, other.ids);
+    tail(arrivals, other.arrivals);
+    tail(bursts, other.bursts);
+    tail(priorities, other.priorities);
+    tail(deadlines, other.deadlines);
+    tail(remainings, other.remainings);
+    tail(starts, other.starts);
+    tail(completions, other.completions);
+    std::size_t base = namePool.size(), first = other.nameOffsets[from];
+    namePool.insert(namePool.end(), other.namePool.begin() + first, other.namePool.end());
+    nameOffsets.reserve(nameOffsets.size() + other.size() - from);
+    for (std::size_t h = from + 1; h <= other.size(); ++h) nameOffsets.push_back(base + (other.nameOffsets[h] - first));
+}
+
+void JobTable::clear() {
+    ids.clear();
+    arrivals.clear();
+    bursts.clear();
+    priorities.clear();
+    deadlines.clear();
+    remainings.clear();
+    starts.clear();
+    completions.clear();
+    namePool.clear();
+    nameOffsets.assign(1, 0);
+}
+
+void JobTable::reserve(std::size_t n) {
+    ids.reserve(n);
+    arrivals.reserve(n);
+    bursts.reserve(n);
+    priorities.reserve(n);
+    deadlines.reserve(n);
+    remainings.reserve(n);
+    starts.reserve(n);
+    completions.reserve(n);
+    nameOffsets.reserve(n + 1);
+}
+
+MetricTotals JobTable::finishedTotals() const {
+    // Branch-free over contiguous columns so the compiler can vectorise it
+    const std::int32_t* arrival = arrivals.data();
+    const std::int32_t* burst = bursts.data();
+    const std::int32_t* completion = completions.data();
+    long long count = 0, waiting = 0, turnaround = 0, totalBurst = 0;
+    std::size_t n = ids.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        long long done = completion[i] >= 0;
+        long long tt = (long long)completion[i] - arrival[i];
+        count += done;
+        turnaround += done * tt;
+        waiting += done * (tt - burst[i]);
+        totalBurst += done * burst[i];
+    }
+    MetricTotals totals;
+    totals.count = count;
+    totals.waiting = waiting;
+    totals.turnaround = turnaround;
+    totals.burst = totalBurst;
+    return totals;
+}
+
+Job JobTable::toJob(JobHandle h) const {
+    Job job(ids[h], arrivals[h], bursts[h], priorities[h], deadlines[h]);
+    job.name.assign(name(h));
+    job.remainingTime = remainings[h];
+    job.startTime = starts[h];
+    job.completionTime = completions[h];
+    if (finished(h)) job.calculateMetrics();
+    return job;
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include "../include/LLFScheduler.h"
+#include "../include/Statistics.h"
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
+bool LLFScheduler::LessLaxity::operator()(JobHandle a, JobHandle b) const {
+    std::int64_t ka = owner->slackKeys[a], kb = owner->slackKeys[b];
+    if (ka != kb) return ka < kb;
+    const JobTable& jobs = *owner->table;
+    if (jobs.arrival(a) != jobs.arrival(b)) return jobs.arrival(a) < jobs.arrival(b);
+    return a < b;
+}
+
+LLFScheduler::LLFScheduler(bool admissionControl)
+    : readyQueue(LessLaxity{ this }, runMemory()), slackKeys(runMemory()), admitted(runMemory()), rejected(runMemory()),
+      admissionControl(admissionControl) {}
+
+std::int64_t LLFScheduler::slackKey(JobHandle job) const {
+    // Laxity at time t is this minus t
+    if (!table->hasDeadline(job)) return std::numeric_limits<std::int64_t>::max();
+    return (std::int64_t)table->deadline(job) - table->remaining(job);
+}
+
+void LLFScheduler::enqueue(JobHandle job) {
+    if (job >= admitted.size()) {
+        admitted.resize(job + 1, 0);
+        slackKeys.resize(job + 1, 0);
+    }
+    slackKeys[job] = slackKey(job);
+    if (!admitted[job]) {
+        if (admissionControl && !DeadlineAdmission::admit(job, readyQueue.items(), *table)) {
+            rejected.push_back(job);
+            return;
+        }
+        admitted[job] = 1;
+    }
+    readyQueue.push(job);
+}
+
+JobHandle LLFScheduler::dequeue() {
+    if (readyQueue.empty()) {
+        return kNoJob;
+    }
+    return readyQueue.pop();
+}
+
+bool LLFScheduler::hasJobs() const {
+    return !readyQueue.empty();
+}
+
+void LLFScheduler::schedule(int currentTime) {
+    // Queued keys do not change while jobs wait, so the heap stays in order
+}
+
+int LLFScheduler::timeSlice(JobHandle job, int currentTime) const {
+    // The running job's laxity stays at key - now; the best waiting job's
+    // drops by one per time unit and draws level after (its key - ours).
+    // On a tie it takes over there if it wins the tie-break, as dequeue()
+    // would decide it, and one unit later otherwise
+    std::int64_t own = slackKey(job);
+    if (readyQueue.empty() || own == std::numeric_limits<std::int64_t>::max()) return table->remaining(job);
+    JobHandle top = readyQueue.top();
+    std::int64_t best = slackKeys[top];
+    if (best == std::numeric_limits<std::int64_t>::max()) return table->remaining(job);
+    bool winsTies = table->arrival(top) != table->arrival(job) ? table->arrival(top) < table->arrival(job) : top < job;
+    std::int64_t level = best - own + (winsTies ? 0 : 1);
+    return (int)std::min<std::int64_t>(table->remaining(job), std::max<std::int64_t>(1, level));
+}
+
+std::vector<JobHandle> LLFScheduler::queuedJobs() const {
+    std::vector<JobHandle> queued(readyQueue.items().begin(), readyQueue.items().end());
+    std::sort(queued.begin(), queued.end(), LessLaxity{ this });
+    return queued;
+}
+
+void LLFScheduler::recycle(JobHandle job) {
+    if (job < admitted.size()) admitted[job] = 0;
+}
+
+void LLFScheduler::takeRejected(std::vector<JobHandle>& into) {
+    into.insert(into.end(), rejected.begin(), rejected.end());
+    rejected.clear();
+}
+
+LLFScheduler::~LLFScheduler() {}
+
+void LLFScheduler::attach(JobTable& jobs) {
+    readyQueue.release();
+    releaseStorage(slackKeys);
+    releaseStorage(admitted);
+    releaseStorage(rejected);
+    Scheduler::attach(jobs);
+}
+
+void LLFScheduler::setJobs(const std::vector<Job>& jobs) {
+    attach(ownTable);
+    attachGantt(ownGantt);
+    ownTable.clear();
+    for (const auto& job : jobs) {
+        enqueue(ownTable.add(job));
+    }
+}
+
+std::string LLFScheduler::getGanttChart() const {
+    return gantt->render(*table);
+}
+
+std::string LLFScheduler::getTimelineLog() const {
+    return events->format(*table);
+}
+
+std::string LLFScheduler::getStatistics() const {
+    std::string report = StatisticsEngine::report(*table, "LLF");
+    if (admissionControl) report += "Rejected at admission: " + std::to_string(rejected.size()) + "\n";
+    return report;
+}
\ No newline at end of file
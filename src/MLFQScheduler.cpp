@@ -0,0 +1,179 @@
+#include "../include/MLFQScheduler.h"
+#include "../include/Statistics.h"
+#include <algorithm>
+#include <sstream>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+
+// Index of the lowest set bit; `bits` must not be zero
+int lowestSetBit(std::uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(bits);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, bits);
+    return (int)index;
+#else
+    int index = 0;
+    while (!(bits & 1)) {
+        bits >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+}
+
+MLFQScheduler::MLFQScheduler(int levels, std::vector<int> levelQuanta, int boostInterval)
+    : nonEmpty(0), quanta(std::move(levelQuanta)),
+      boostInterval(std::max(0, boostInterval)), nextBoost(this->boostInterval), boostEpoch(0),
+      level(runMemory()), used(runMemory()), dispatchedRemaining(runMemory()), dispatchedEpoch(runMemory()) {
+    int count = std::min(std::max(levels, 1), kMaxLevels);
+    queues.reserve(count);
+    for (int i = 0; i < count; ++i) queues.emplace_back(runMemory());
+    quanta.resize(queues.size(), 0);
+    for (std::size_t i = 0; i < quanta.size(); ++i) {
+        if (quanta[i] <= 0) quanta[i] = i == 0 ? 2 : quanta[i - 1] * 2;
+    }
+}
+
+void MLFQScheduler::push(JobHandle job, int lvl, bool front) {
+    level[job] = lvl;
+    if (front) queues[lvl].push_front(job);
+    else queues[lvl].push_back(job);
+    nonEmpty |= std::uint64_t(1) << lvl;
+}
+
+void MLFQScheduler::enqueue(JobHandle job) {
+    if (job >= level.size()) {
+        level.resize(job + 1, 0);
+        used.resize(job + 1, 0);
+        dispatchedRemaining.resize(job + 1, -1);
+        dispatchedEpoch.resize(job + 1, 0);
+    }
+    if (dispatchedRemaining[job] < 0) {
+        // New arrival
+        used[job] = 0;
+        push(job, 0, false);
+        return;
+    }
+    int ran = dispatchedRemaining[job] - table->remaining(job);
+    dispatchedRemaining[job] = -1;
+    if (dispatchedEpoch[job] != boostEpoch) {
+        // A boost happened while it was running
+        used[job] = 0;
+        push(job, 0, false);
+        return;
+    }
+    used[job] += ran;
+    int lvl = level[job];
+    if (used[job] >= quanta[lvl]) {
+        // Quantum used up: demote, and queue behind the level's other jobs
+        used[job] = 0;
+        push(job, std::min(lvl + 1, (int)queues.size() - 1), false);
+    } else {
+        // Cut short by an arrival or a boost: resume first in its level
+        push(job, lvl, true);
+    }
+}
+
+JobHandle MLFQScheduler::dequeue() {
+    if (nonEmpty == 0) {
+        return kNoJob;
+    }
+    int lvl = lowestSetBit(nonEmpty);
+    JobHandle job = queues[lvl].pop_front();
+    if (queues[lvl].empty()) nonEmpty &= ~(std::uint64_t(1) << lvl);
+    dispatchedRemaining[job] = table->remaining(job);
+    dispatchedEpoch[job] = boostEpoch;
+    return job;
+}
+
+bool MLFQScheduler::hasJobs() const {
+    return nonEmpty != 0;
+}
+
+void MLFQScheduler::schedule(int currentTime) {
+    if (boostInterval == 0 || currentTime < nextBoost) return;
+    boost();
+    nextBoost = (currentTime / boostInterval + 1) * boostInterval;
+}
+
+void MLFQScheduler::boost() {
+    // Lower levels move up in level order, so each keeps its FIFO order
+    for (std::size_t i = 0; i < queues[0].size(); ++i) used[queues[0][i]] = 0;
+    for (std::size_t lvl = 1; lvl < queues.size(); ++lvl) {
+        for (std::size_t i = 0; i < queues[lvl].size(); ++i) {
+            JobHandle job = queues[lvl][i];
+            used[job] = 0;
+            level[job] = 0;
+            queues[0].push_back(job);
+        }
+        queues[lvl].clear();
+    }
+    nonEmpty = queues[0].empty() ? 0 : 1;
+    ++boostEpoch;
+}
+
+int MLFQScheduler::timeSlice(JobHandle job, int currentTime) const {
+    // What is left of the level's quantum, stopping at the next boost
+    int slice = quanta[level[job]] - used[job];
+    if (boostInterval > 0) slice = std::min(slice, nextBoost - currentTime);
+    return std::max(1, slice);
+}
+
+std::vector<JobHandle> MLFQScheduler::queuedJobs() const {
+    std::vector<JobHandle> queued;
+    for (const auto& queue : queues) queue.copyTo(queued);
+    return queued;
+}
+
+void MLFQScheduler::recycle(JobHandle job) {
+    // The last dispatch ended in completion, so nothing cleared it
+    if (job < dispatchedRemaining.size()) dispatchedRemaining[job] = -1;
+}
+
+MLFQScheduler::~MLFQScheduler() {}
+
+void MLFQScheduler::attach(JobTable& jobs) {
+    for (auto& queue : queues) queue.release();
+    releaseStorage(level);
+    releaseStorage(used);
+    releaseStorage(dispatchedRemaining);
+    releaseStorage(dispatchedEpoch);
+    Scheduler::attach(jobs);
+    nonEmpty = 0;
+    nextBoost = boostInterval;
+    boostEpoch = 0;
+}
+
+void MLFQScheduler::setJobs(const std::vector<Job>& jobs) {
+    attach(ownTable);
+    attachGantt(ownGantt);
+    ownTable.clear();
+    for (const auto& job : jobs) {
+        enqueue(ownTable.add(job));
+    }
+}
+
+std::string MLFQScheduler::getGanttChart() const {
+    return gantt->render(*table);
+}
+
+std::string MLFQScheduler::getTimelineLog() const {
+    return events->format(*table);
+}
+
+std::string MLFQScheduler::getStatistics() const {
+    return StatisticsEngine::report(*table, "MLFQ");
+}
+
+std::string MLFQScheduler::configKey() const {
+    std::string key = "MLFQ quanta=";
+    for (std::size_t i = 0; i < quanta.size(); ++i) key += (i ? "," : "") + std::to_string(quanta[i]);
+    return key + " boost=" + std::to_string(boostInterval);
+}
\ No newline at end of file
@@ -0,0 +1,225 @@
+#include "../include/MultiCoreSimulator.h"
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+MultiCoreSimulator::MultiCoreSimulator(SchedulerFactory create, std::vector<Job> jobs,
+                                       const MultiCoreConfig& config)
+    : MultiCoreSimulator(std::move(create), std::make_unique<VectorArrivalSource>(std::move(jobs)), config) {}
+
+MultiCoreSimulator::MultiCoreSimulator(SchedulerFactory create, std::unique_ptr<ArrivalSource> source,
+                                       const MultiCoreConfig& cfg)
+    : config(cfg), arrivals(std::move(source)) {
+    config.cores = std::max(1, config.cores);
+    config.migrationCost = std::max(0, config.migrationCost);
+    cores.resize(config.cores);
+    if (config.mode == CoreQueueMode::Global) {
+        // A global scheduler renders core 0's lane; report() shows them all
+        global = create();
+        global->attach(jobs);
+        global->attachGantt(cores[0].lane);
+        return;
+    }
+    for (auto& core : cores) {
+        core.scheduler = create();
+        core.scheduler->attach(jobs);
+        core.scheduler->attachGantt(core.lane);
+    }
+}
+
+void MultiCoreSimulator::run() {
+    // Event-driven like Simulator: time jumps to the next slice end or arrival
+    admitArrivals(currentTime);
+    dispatch(currentTime);
+    while (true) {
+        long long next = std::numeric_limits<long long>::max();
+        for (const auto& core : cores)
+            if (core.job != kNoJob) next = std::min<long long>(next, core.end);
+        if (arrivals->hasNext()) next = std::min<long long>(next, std::max(arrivals->peekArrivalTime(), currentTime));
+        if (next == std::numeric_limits<long long>::max()) break;
+        int now = (int)next;
+
+        // Jobs that arrived while the cores were busy queue up ahead of the
+        // ones handed back now
+        admitArrivals(now - 1);
+        for (int c = 0; c < coreCount(); ++c)
+            if (cores[c].job != kNoJob && cores[c].end == now) stop(c, now);
+        admitArrivals(now);
+        // Preemptive queues order by priority rather than by insertion, so
+        // their cores can be handed back after the arrivals are placed
+        for (int c = 0; c < coreCount(); ++c) {
+            const Core& core = cores[c];
+            if (core.job == kNoJob || core.runFrom > now || !queueOf(c).preemptsOnArrival()) continue;
+            if (global || core.arrived) stop(c, now);
+        }
+        dispatch(now);
+        currentTime = now;
+    }
+
+    RunStatistics stats = StatisticsEngine::compute(jobs);
+    for (auto& core : cores)
+        core.stats.utilization = stats.makespan > 0 ? (double)core.stats.busy / stats.makespan : 0;
+}
+
+void MultiCoreSimulator::enqueue(int core, JobHandle job) {
+    queueOf(core).enqueue(job);
+    if (!global) ++cores[core].queued;
+}
+
+void MultiCoreSimulator::admitArrivals(int upTo) {
+    while (arrivals->hasNext() && arrivals->peekArrivalTime() <= upTo) {
+        JobHandle job = arrivals->admit(jobs);
+        lastCore.resize(jobs.size(), -1);
+        if (global) {
+            global->enqueue(job);
+            continue;
+        }
+        // Least loaded core, counting the job it is running
+        int target = 0;
+        long long best = std::numeric_limits<long long>::max();
+        for (int c = 0; c < coreCount(); ++c) {
+            long long load = cores[c].queued + (cores[c].job != kNoJob);
+            if (load < best) {
+                best = load;
+                target = c;
+            }
+        }
+        enqueue(target, job);
+        cores[target].arrived = true;
+    }
+}
+
+void MultiCoreSimulator::stop(int c, int now) {
+    Core& core = cores[c];
+    JobHandle job = core.job;
+    int ran = std::max(0, now - core.runFrom);
+    core.lane.record(job, core.runFrom, ran);
+    core.stats.busy += ran;
+    jobs.setRemaining(job, jobs.remaining(job) - ran);
+    core.job = kNoJob;
+    if (jobs.remaining(job) <= 0) jobs.complete(job, now);
+    else enqueue(c, job);   // partitioned: back on the core it ran on
+}
+
+bool MultiCoreSimulator::anyQueued() const {
+    if (global) return global->hasJobs();
+    for (const auto& core : cores)
+        if (core.queued > 0) return true;
+    return false;
+}
+
+void MultiCoreSimulator::dispatch(int now) {
+    // Next job from one queue; jobs with nothing left to run finish on the spot
+    auto take = [&](Scheduler& queue, long long* queued) {
+        while (queue.hasJobs()) {
+            queue.schedule(now);
+            JobHandle job = queue.dequeue();
+            if (queued) --*queued;
+            if (jobs.remaining(job) > 0) return job;
+            if (jobs.start(job) == -1) jobs.setStart(job, now);
+            jobs.complete(job, now);
+        }
+        if (queued) *queued = 0;   // the count includes any jobs the policy turned away
+        return kNoJob;
+    };
+
+    std::vector<int> idle;
+    for (int c = 0; c < coreCount(); ++c)
+        if (cores[c].job == kNoJob) idle.push_back(c);
+    if (idle.empty() || !anyQueued()) return;
+
+    if (global) {
+        // Take one job per idle core, then seat each on the core it last ran
+        // on when that core is free, so re-deciding does not migrate for nothing
+        std::vector<JobHandle> picked;
+        while (picked.size() < idle.size()) {
+            JobHandle job = take(*global, nullptr);
+            if (job == kNoJob) break;
+            picked.push_back(job);
+        }
+        std::vector<bool> seated(picked.size(), false);
+        for (std::size_t i = 0; i < picked.size(); ++i) {
+            int last = lastCore[picked[i]];
+            if (last >= 0 && cores[last].job == kNoJob) {
+                start(last, picked[i], now);
+                seated[i] = true;
+            }
+        }
+        std::size_t next = 0;
+        for (int c : idle) {
+            if (cores[c].job != kNoJob) continue;
+            while (next < picked.size() && seated[next]) ++next;
+            if (next == picked.size()) break;
+            start(c, picked[next], now);
+            seated[next] = true;
+        }
+        return;
+    }
+
+    for (int c : idle) {
+        JobHandle job = take(*cores[c].scheduler, &cores[c].queued);
+        if (job != kNoJob) start(c, job, now);
+    }
+    if (!config.workStealing) return;
+    for (int c : idle) {
+        while (cores[c].job == kNoJob) {
+            // Steal from the longest queue; ties go to the lowest core
+            int victim = -1;
+            for (int v = 0; v < coreCount(); ++v)
+                if (v != c && cores[v].queued > 0 && (victim == -1 || cores[v].queued > cores[victim].queued))
+                    victim = v;
+            if (victim == -1) return;
+            JobHandle job = take(*cores[victim].scheduler, &cores[victim].queued);
+            if (job == kNoJob) continue;
+            ++cores[c].stats.steals;
+            start(c, job, now);
+        }
+    }
+}
+
+void MultiCoreSimulator::start(int c, JobHandle job, int now) {
+    Core& core = cores[c];
+    int cost = (lastCore[job] >= 0 && lastCore[job] != c) ? config.migrationCost : 0;
+    if (lastCore[job] >= 0 && lastCore[job] != c) {
+        ++core.stats.migrations;
+        core.stats.migrationTime += cost;
+    }
+    core.runFrom = now + cost;
+    if (jobs.start(job) == -1) jobs.setStart(job, core.runFrom);
+    int slice = std::max(1, std::min(queueOf(c).timeSlice(job, core.runFrom), jobs.remaining(job)));
+    core.end = core.runFrom + slice;
+    core.job = job;
+    core.arrived = false;
+    lastCore[job] = c;
+    ++core.stats.dispatches;
+}
+
+RunStatistics MultiCoreSimulator::statistics() const {
+    RunStatistics stats = StatisticsEngine::compute(jobs);
+    long long busy = 0;
+    for (const auto& core : cores) busy += core.stats.busy;
+    stats.cpuUtilization = stats.makespan > 0 ? (double)busy / ((double)stats.makespan * coreCount()) : 0;
+    return stats;
+}
+
+std::string MultiCoreSimulator::report() const {
+    std::ostringstream oss;
+    oss << coreCount() << " cores, "
+        << (global ? "global queue" : config.workStealing ? "partitioned queues with work stealing" : "partitioned queues")
+        << ", migration cost " << config.migrationCost << "\n";
+    for (int c = 0; c < coreCount(); ++c) oss << "CPU " << c << " " << cores[c].lane.render(jobs) << "\n";
+
+    oss << std::fixed << std::setprecision(2);
+    oss << std::left << std::setw(6) << "CPU" << std::right << std::setw(10) << "Busy" << std::setw(8) << "Util%"
+        << std::setw(12) << "Dispatches" << std::setw(12) << "Migrations" << std::setw(12) << "Migr. time"
+        << std::setw(8) << "Steals" << "\n";
+    for (int c = 0; c < coreCount(); ++c) {
+        const CoreStats& s = cores[c].stats;
+        oss << std::left << std::setw(6) << c << std::right << std::setw(10) << s.busy
+            << std::setw(8) << s.utilization * 100 << std::setw(12) << s.dispatches
+            << std::setw(12) << s.migrations << std::setw(12) << s.migrationTime << std::setw(8) << s.steals << "\n";
+    }
+    oss << StatisticsEngine::formatSummary(statistics());
+    return oss.str();
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include "../include/OutputBuffer.h"
+#include <charconv>
+#include <iostream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <unistd.h>
+#define OUTPUT_BUFFER_POSIX 1
+#endif
+
+namespace {
+
+std::string_view formatInt(long long value, char (&digits)[24]) {
+    auto [end, ec] = std::to_chars(digits, digits + sizeof digits, value);
+    (void)ec;
+    return std::string_view(digits, end - digits);
+}
+
+}
+
+OutputBuffer::OutputBuffer(std::size_t reserve) {
+    text.reserve(reserve);
+}
+
+OutputBuffer::OutputBuffer(std::FILE* file, std::size_t limit) : file(file), limit(limit) {
+    text.reserve(limit + 4096);
+}
+
+OutputBuffer::~OutputBuffer() {
+    if (file) flush();
+}
+
+void OutputBuffer::appendInt(long long value) {
+    char digits[24];
+    append(formatInt(value, digits));
+}
+
+void OutputBuffer::appendLeft(std::string_view s, std::size_t width) {
+    text.append(s);
+    if (s.size() < width) text.append(width - s.size(), ' ');
+    spill();
+}
+
+void OutputBuffer::appendRight(std::string_view s, std::size_t width) {
+    if (s.size() < width) text.append(width - s.size(), ' ');
+    text.append(s);
+    spill();
+}
+
+void OutputBuffer::appendIntLeft(long long value, std::size_t width) {
+    char digits[24];
+    appendLeft(formatInt(value, digits), width);
+}
+
+void OutputBuffer::appendIntRight(long long value, std::size_t width) {
+    char digits[24];
+    appendRight(formatInt(value, digits), width);
+}
+
+std::string OutputBuffer::take() {
+    std::string out = std::move(text);
+    text.clear();
+    return out;
+}
+
+bool OutputBuffer::flush() {
+    if (!file || text.empty()) return good;
+    if (std::fwrite(text.data(), 1, text.size(), file) != text.size()) good = false;
+    text.clear();
+    return good;
+}
+
+bool OutputBuffer::writeToStdout() {
+    std::cout.flush();
+    std::fflush(stdout);
+#ifdef OUTPUT_BUFFER_POSIX
+    // A terminal or pipe may take less than asked; carry on from there
+    const char* p = text.data();
+    std::size_t left = text.size();
+    while (left > 0) {
+        ssize_t n = ::write(STDOUT_FILENO, p, left);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) { good = false; break; }
+        p += n;
+        left -= (std::size_t)n;
+    }
+#else
+    if (std::fwrite(text.data(), 1, text.size(), stdout) != text.size()) good = false;
+    std::fflush(stdout);
+#endif
+    text.clear();
+    return good;
+}
\ No newline at end of file
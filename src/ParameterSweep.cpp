@@ -0,0 +1,336 @@
+#include "../include/ParameterSweep.h"
+#include "../include/Simulator.h"
+#include "../include/RoundRobinScheduler.h"
+#include "../include/PriorityScheduler.h"
+#include "../include/RunArena.h"
+#include "../include/ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <sstream>
+
+namespace {
+
+// Dispatches between checks of SweepOptions::cancel
+constexpr long long kCancelInterval = 1024;
+
+bool cancelRequested(const SweepOptions& options) {
+    return options.cancel && options.cancel->load(std::memory_order_relaxed);
+}
+
+// Best finished value of the target across every worker
+class BestSoFar {
+public:
+    double get() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return value;
+    }
+    void offer(double candidate) {
+        std::lock_guard<std::mutex> lock(mutex);
+        value = std::min(value, candidate);
+    }
+
+private:
+    std::mutex mutex;
+    double value = std::numeric_limits<double>::infinity();
+};
+
+std::unique_ptr<Scheduler> makeScheduler(const SweepPoint& point) {
+    if (point.family == "RR") return std::make_unique<RoundRobinScheduler>(point.quantum);
+    return std::make_unique<PriorityScheduler>(point.agingThreshold, point.agingIncrement);
+}
+
+bool isWaitingMetric(SweepMetric metric) {
+    return metric == SweepMetric::AvgWaiting || metric == SweepMetric::P95Waiting ||
+           metric == SweepMetric::P99Waiting;
+}
+
+// Lower bound on the target over every way the run could still finish.
+// Finished jobs count as they are; a queued job cannot complete before it has
+// run its remaining time from now; a job yet to arrive cannot start before
+// now or its arrival. Per-job bounds bound every percentile as well.
+double lowerBound(const Simulator& sim, const SharedJobSet& set, SweepMetric metric) {
+    const JobTable& jobs = sim.getJobTable();
+    const JobTable& pending = set.table();
+    long long now = sim.getCurrentTime();
+    bool waiting = isWaitingMetric(metric);
+    std::vector<std::int32_t> values;
+    values.reserve(set.size());
+    for (JobHandle h = 0; h < jobs.size(); ++h) {
+        long long tt = jobs.finished(h) ? jobs.turnaround(h) : now + jobs.remaining(h) - jobs.arrival(h);
+        values.push_back((std::int32_t)(waiting ? tt - jobs.burst(h) : tt));
+    }
+    for (std::size_t i = jobs.size(); i < set.size(); ++i) {
+        JobHandle h = set.arrivalOrder()[i];
+        long long wt = std::max(0LL, now - pending.arrival(h));
+        values.push_back((std::int32_t)(waiting ? wt : wt + pending.burst(h)));
+    }
+    RunStatistics bound;
+    (waiting ? bound.waiting : bound.turnaround) = StatisticsEngine::describe(values);
+    return ParameterSweep::metricValue(bound, metric);
+}
+
+// Simulates one point, from the start or from `from`. When `keep` is given,
+// the latest checkpoint still inside the scheduler's shared-prefix horizon is
+// left there. Returns true if that horizon never closed, i.e. the whole run
+// is shared. The run's storage comes from the worker thread's arena, so
+// successive points on a thread reuse one buffer.
+bool simulatePoint(SweepPoint& point, const std::shared_ptr<const SharedJobSet>& jobs,
+                   const SweepOptions& options, long long interval, BestSoFar& best,
+                   const SimulatorCheckpoint* from, SimulatorCheckpoint* keep, bool* kept) {
+    auto begin = std::chrono::steady_clock::now();
+    RunArena::Scope arena;
+    std::unique_ptr<Simulator> sim = from
+        ? std::make_unique<Simulator>(makeScheduler(point), jobs, *from, arena.resource())
+        : std::make_unique<Simulator>(makeScheduler(point), std::make_unique<SharedArrivalSource>(jobs),
+                                      arena.resource());
+    sim->setEventLogging(false);
+    sim->setSketching(options.sketches);
+    if (from) point.sharedUpTo = from->time;
+    bool horizonOpen = keep != nullptr;
+    long long dispatches = 0;
+    while (sim->step()) {
+        ++dispatches;
+        if (dispatches % kCancelInterval == 0 && cancelRequested(options)) {
+            point.cancelled = true;
+            break;
+        }
+        if (dispatches % interval != 0) continue;
+        if (horizonOpen) {
+            if (sim->getCurrentTime() <= sim->getScheduler().sharedPrefixHorizon()) {
+                *keep = sim->checkpoint();
+                *kept = true;
+            } else {
+                horizonOpen = false;
+            }
+        }
+        if (options.pruneDominated) {
+            double bound = lowerBound(*sim, *jobs, options.target);
+            if (bound > best.get()) {
+                point.pruned = true;
+                point.bound = bound;
+                break;
+            }
+        }
+    }
+    if (!point.pruned && !point.cancelled) {
+        point.stats = options.sketches ? sim->getSketches()->statistics()
+                                       : StatisticsEngine::compute(sim->getJobTable());
+        best.offer(ParameterSweep::metricValue(point.stats, options.target));
+    }
+    point.wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    if (options.onPoint) options.onPoint(point);
+    return !point.pruned && !point.cancelled && sim->getScheduler().sharedPrefixHorizon() >= sim->getCurrentTime();
+}
+
+}
+
+std::vector<int> SweepGrid::range(int from, int to, int step) {
+    std::vector<int> values;
+    if (step <= 0) step = 1;
+    for (long long v = from; v <= to; v += step) values.push_back((int)v);
+    return values;
+}
+
+double ParameterSweep::metricValue(const RunStatistics& stats, SweepMetric metric) {
+    switch (metric) {
+    case SweepMetric::AvgWaiting: return stats.waiting.mean;
+    case SweepMetric::P95Waiting: return stats.waiting.p95;
+    case SweepMetric::P99Waiting: return stats.waiting.p99;
+    case SweepMetric::AvgTurnaround: return stats.turnaround.mean;
+    case SweepMetric::P99Turnaround: return stats.turnaround.p99;
+    }
+    return 0;
+}
+
+const char* ParameterSweep::metricName(SweepMetric metric) {
+    switch (metric) {
+    case SweepMetric::AvgWaiting: return "average waiting time";
+    case SweepMetric::P95Waiting: return "p95 waiting time";
+    case SweepMetric::P99Waiting: return "p99 waiting time";
+    case SweepMetric::AvgTurnaround: return "average turnaround time";
+    case SweepMetric::P99Turnaround: return "p99 turnaround time";
+    }
+    return "";
+}
+
+std::vector<SweepPoint> ParameterSweep::run(std::shared_ptr<const SharedJobSet> jobs, const SweepGrid& grid,
+                                            const SweepOptions& options) {
+    std::vector<SweepPoint> points;
+    // Each family lists its points strictest first
+    std::vector<std::vector<std::size_t>> families;
+    if (!grid.rrQuanta.empty()) {
+        families.emplace_back();
+        for (int quantum : grid.rrQuanta) {
+            SweepPoint point;
+            point.family = "RR";
+            point.quantum = quantum;
+            point.label = "RR q=" + std::to_string(quantum);
+            families.back().push_back(points.size());
+            points.push_back(point);
+        }
+        std::stable_sort(families.back().begin(), families.back().end(), [&points](std::size_t a, std::size_t b) {
+            return points[a].quantum < points[b].quantum;
+        });
+    }
+    if (!grid.agingThresholds.empty() && !grid.agingIncrements.empty()) {
+        families.emplace_back();
+        for (int threshold : grid.agingThresholds) {
+            for (int increment : grid.agingIncrements) {
+                SweepPoint point;
+                point.family = "Priority";
+                point.agingThreshold = threshold;
+                point.agingIncrement = increment;
+                point.label = "Priority t=" + std::to_string(threshold) + " i=" + std::to_string(increment);
+                families.back().push_back(points.size());
+                points.push_back(point);
+            }
+        }
+        std::stable_sort(families.back().begin(), families.back().end(), [&points](std::size_t a, std::size_t b) {
+            return points[a].agingThreshold < points[b].agingThreshold;
+        });
+    }
+
+    // Checkpoints and bounds cost O(jobs) each, so space them out by a few
+    // dispatches per job
+    long long interval = options.checkInterval > 0 ? options.checkInterval : 4 * (long long)jobs->size() + 256;
+    BestSoFar best;
+    ThreadPool pool(options.threads);
+    std::mutex variantsMutex;
+    std::vector<std::future<void>> variants;
+    std::vector<std::future<void>> probes;
+    for (const auto& family : families) {
+        // The strictest point runs first and hands its checkpoint to the rest,
+        // which are queued from the worker rather than waited on there
+        probes.push_back(pool.submit([&, family] {
+            SweepPoint& probe = points[family.front()];
+            auto checkpoint = std::make_shared<SimulatorCheckpoint>();
+            bool kept = false;
+            bool shared = simulatePoint(probe, jobs, options, interval, best, nullptr,
+                                        options.sharePrefixes ? checkpoint.get() : nullptr, &kept);
+            std::shared_ptr<const SimulatorCheckpoint> from;
+            if (kept) from = checkpoint;
+            for (std::size_t i = 1; i < family.size(); ++i) {
+                SweepPoint& point = points[family[i]];
+                if (probe.cancelled || cancelRequested(options)) {
+                    point.cancelled = true;
+                    if (options.onPoint) options.onPoint(point);
+                    continue;
+                }
+                if (options.sharePrefixes && shared) {
+                    point.stats = probe.stats;
+                    point.reused = true;
+                    point.sharedUpTo = probe.stats.makespan;
+                    if (options.onPoint) options.onPoint(point);
+                    continue;
+                }
+                std::lock_guard<std::mutex> lock(variantsMutex);
+                variants.push_back(pool.submit([&, from, index = family[i]] {
+                    if (cancelRequested(options)) {
+                        points[index].cancelled = true;
+                        if (options.onPoint) options.onPoint(points[index]);
+                        return;
+                    }
+                    simulatePoint(points[index], jobs, options, interval, best, from.get(), nullptr, nullptr);
+                }));
+            }
+        }));
+    }
+    for (auto& probe : probes) probe.get();
+    // Every variant is queued by the time the probes are done
+    for (auto& variant : variants) variant.get();
+    return points;
+}
+
+std::string ParameterSweep::formatRanking(const std::vector<SweepPoint>& points, SweepMetric metric) {
+    std::vector<const SweepPoint*> order;
+    for (const auto& point : points) order.push_back(&point);
+    std::stable_sort(order.begin(), order.end(), [metric](const SweepPoint* a, const SweepPoint* b) {
+        if (a->cancelled != b->cancelled) return !a->cancelled;
+        if (a->cancelled) return false;
+        if (a->pruned != b->pruned) return !a->pruned;
+        double va = a->pruned ? a->bound : ParameterSweep::metricValue(a->stats, metric);
+        double vb = b->pruned ? b->bound : ParameterSweep::metricValue(b->stats, metric);
+        return va < vb;
+    });
+
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2);
+    oss << "Ranked by " << metricName(metric) << "\n";
+    oss << std::right << std::setw(5) << "Rank" << "  " << std::left << std::setw(20) << "Config" << std::right
+        << std::setw(12) << "Target" << std::setw(12) << "Avg WT" << std::setw(11) << "p99 WT"
+        << std::setw(12) << "Avg TT" << std::setw(11) << "p99 TT"
+        << std::setw(12) << "Resumed at" << std::setw(10) << "Sim ms" << "\n";
+    int rank = 0;
+    std::size_t pruned = 0, resumed = 0, reused = 0, cancelled = 0;
+    for (const SweepPoint* point : order) {
+        const RunStatistics& s = point->stats;
+        if (point->cancelled) {
+            ++cancelled;
+            oss << std::setw(5) << "-" << "  " << std::left << std::setw(20) << point->label << std::right
+                << std::setw(12) << "-" << "  cancelled\n";
+            continue;
+        }
+        if (point->pruned) {
+            ++pruned;
+            oss << std::setw(5) << "-" << "  " << std::left << std::setw(20) << point->label << std::right
+                << std::setw(12) << (">" + std::to_string((long long)point->bound))
+                << "  pruned: dominated by a finished config\n";
+            continue;
+        }
+        if (point->reused) ++reused;
+        else if (point->sharedUpTo >= 0) ++resumed;
+        oss << std::setw(5) << ++rank << "  " << std::left << std::setw(20) << point->label << std::right
+            << std::setw(12) << metricValue(s, metric)
+            << std::setw(12) << s.waiting.mean << std::setw(11) << s.waiting.p99
+            << std::setw(12) << s.turnaround.mean << std::setw(11) << s.turnaround.p99;
+        if (point->reused) oss << std::setw(12) << "shared";
+        else if (point->sharedUpTo >= 0) oss << std::setw(12) << point->sharedUpTo;
+        else oss << std::setw(12) << "-";
+        oss << std::setw(10) << point->wallMs << "\n";
+    }
+    oss << points.size() << " configs: " << reused << " identical to a stricter one, "
+        << resumed << " resumed from a shared prefix, " << pruned << " pruned";
+    if (cancelled > 0) oss << ", " << cancelled << " cancelled";
+    oss << "\n";
+    if (rank > 0) oss << "Best: " << order.front()->label << "\n";
+    return oss.str();
+}
+
+bool ParameterSweep::writeCsv(const std::string& path, const std::vector<SweepPoint>& points,
+                              SweepMetric metric, std::string& error) {
+    std::ofstream out(path);
+    if (!out) {
+        error = "cannot open " + path + " for writing";
+        return false;
+    }
+    out << "family,quantum,aging_threshold,aging_increment,status,target,avg_wt,p50_wt,p95_wt,p99_wt,"
+           "avg_tt,p99_tt,avg_rt,throughput,cpu_utilization,makespan,resumed_at,sim_ms\n";
+    for (const auto& point : points) {
+        const RunStatistics& s = point.stats;
+        out << point.family << ',' << point.quantum << ',' << point.agingThreshold << ',' << point.agingIncrement << ','
+            << (point.cancelled ? "cancelled" : point.pruned ? "pruned" : point.reused ? "shared" : "done") << ',';
+        if (point.cancelled) {
+            out << ",,,,,,,,,,," << point.sharedUpTo << ',' << point.wallMs << '\n';
+            continue;
+        }
+        out << (point.pruned ? point.bound : metricValue(s, metric));
+        if (point.pruned) {
+            out << ",,,,,,,,,,," << point.sharedUpTo << ',' << point.wallMs << '\n';
+            continue;
+        }
+        out << ',' << s.waiting.mean << ',' << s.waiting.p50 << ',' << s.waiting.p95 << ',' << s.waiting.p99
+            << ',' << s.turnaround.mean << ',' << s.turnaround.p99 << ',' << s.response.mean
+            << ',' << s.throughput << ',' << s.cpuUtilization << ',' << s.makespan
+            << ',' << point.sharedUpTo << ',' << point.wallMs << '\n';
+    }
+    if (!out) {
+        error = "write to " + path + " failed";
+        return false;
+    }
+    return true;
+}
\ No newline at end of file
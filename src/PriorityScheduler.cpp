@@ -1,125 +1,291 @@
 #include "../include/PriorityScheduler.h"
+#include "../include/Statistics.h"
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
+#include <limits>
 
-PriorityScheduler::PriorityScheduler(int agingThreshold, int agingIncrement)
-    : agingThreshold(agingThreshold), agingIncrement(agingIncrement) {}
+bool PriorityScheduler::HigherPriority::operator()(JobHandle a, JobHandle b) const {
+    // Lowest priority value first; ties go to the earlier arrival, then admission order
+    int pa = owner->currentPriority(a), pb = owner->currentPriority(b);
+    if (pa != pb) return pa < pb;
+    return EarlierArrival{ owner }(a, b);
+}
+
+bool PriorityScheduler::EarlierAgingKey::operator()(JobHandle a, JobHandle b) const {
+    if (owner->agingKeys[a] != owner->agingKeys[b]) return owner->agingKeys[a] < owner->agingKeys[b];
+    return EarlierArrival{ owner }(a, b);
+}
+
+bool PriorityScheduler::EarlierArrival::operator()(JobHandle a, JobHandle b) const {
+    const JobTable& jobs = *owner->table;
+    if (jobs.arrival(a) != jobs.arrival(b)) return jobs.arrival(a) < jobs.arrival(b);
+    return a < b;
+}
+
+PriorityScheduler::PriorityScheduler(int agingThreshold, int agingIncrement, bool lazyAging)
+    : priorities(runMemory()), agingKeys(runMemory()),
+      priorityQueue(HigherPriority{ this }, runMemory()),
+      agingQueue(EarlierAgingKey{ this }, runMemory()),
+      clampedQueue(EarlierArrival{ this }, runMemory()),
+      agingStarts(EarlierArrival{ this }, runMemory()),
+      agingThreshold(agingThreshold), agingIncrement(agingIncrement),
+      // Aging keys only order jobs correctly while aging lowers priorities
+      lazyAging(lazyAging && agingIncrement > 0), lastAgingTime(-1),
+      sharedHorizon(std::numeric_limits<int>::max()) {}
+
+long long PriorityScheduler::agingFrom(JobHandle job) const {
+    // Aging starts once a job has waited past the threshold, but never counts
+    // time before the clock starts (arrivals before 0 are admitted at 0)
+    return std::max(-1LL, (long long)table->arrival(job) + agingThreshold);
+}
+
+int PriorityScheduler::currentPriority(JobHandle job) const {
+    // Lazy aging never rewrites a priority; eager aging keeps its own copy
+    return lazyAging ? table->priority(job) : priorities[job];
+}
+
+void PriorityScheduler::enqueue(JobHandle job) {
+    place(job);
+}
+
+void PriorityScheduler::place(JobHandle job) {
+    if (!lazyAging) {
+        // A job coming back from the CPU keeps the priority it has aged to
+        const int unset = std::numeric_limits<int>::min();
+        if (job >= priorities.size()) priorities.resize(job + 1, unset);
+        if (priorities[job] == unset) priorities[job] = table->priority(job);
+        priorityQueue.push(job);
+        return;
+    }
+    // File the job under the class it belongs to as of the last decision;
+    // schedule() moves it on from there
+    if (job >= agingKeys.size()) agingKeys.resize(job + 1, 0);
+    long long from = agingFrom(job);
+    agingKeys[job] = table->priority(job) + (long long)agingIncrement * from;
+    if (from >= lastAgingTime) {
+        priorityQueue.push(job);
+        agingStarts.push(job);
+    } else if (agingKeys[job] - (long long)agingIncrement * lastAgingTime <= 0) {
+        clampedQueue.push(job);
+    } else {
+        agingQueue.push(job);
+    }
+}
 
-void PriorityScheduler::addJob(const Job& job) {
-    priorityQueue.push_back(job);
+JobHandle PriorityScheduler::bestJob() const {
+    // Each class keeps a fixed order between crossings, so the best job is one
+    // of the three heap tops
+    JobHandle best = kNoJob;
+    long long bestPriority = 0;
+    auto consider = [&](JobHandle job, long long priority) {
+        if (best == kNoJob || priority < bestPriority ||
+            (priority == bestPriority && EarlierArrival{ this }(job, best))) {
+            best = job;
+            bestPriority = priority;
+        }
+    };
+    if (!priorityQueue.empty()) consider(priorityQueue.top(), currentPriority(priorityQueue.top()));
+    if (!agingQueue.empty())
+        consider(agingQueue.top(), agingKeys[agingQueue.top()] - (long long)agingIncrement * lastAgingTime);
+    if (!clampedQueue.empty()) consider(clampedQueue.top(), 0);
+    return best;
 }
 
-Job PriorityScheduler::getNextJob() {
-    if (priorityQueue.empty()) {
-        return Job(-1, 0, 0, 0);
+JobHandle PriorityScheduler::dequeue() {
+    if (!hasJobs()) {
+        return kNoJob;
+    }
+    // Highest priority (lowest priority value) wins
+    JobHandle job = lazyAging ? bestJob() : priorityQueue.top();
+    priorityQueue.remove(job);
+    if (lazyAging) {
+        agingQueue.remove(job);
+        clampedQueue.remove(job);
+        agingStarts.remove(job);
     }
-    // Find job with highest priority (lowest priority value)
-    auto it = std::min_element(priorityQueue.begin(), priorityQueue.end(),
-        [](const Job& a, const Job& b) {
-            return a.priority < b.priority;
-        });
-    Job job = *it;
-    priorityQueue.erase(it);
     return job;
 }
 
+std::vector<JobHandle> PriorityScheduler::queuedJobs() const {
+    // Heap order is fixed by the comparators, so any order re-enqueues the
+    // same queue; arrival order keeps equal queues listed alike
+    std::vector<JobHandle> queued(priorityQueue.items().begin(), priorityQueue.items().end());
+    if (lazyAging) {
+        queued.insert(queued.end(), agingQueue.items().begin(), agingQueue.items().end());
+        queued.insert(queued.end(), clampedQueue.items().begin(), clampedQueue.items().end());
+    }
+    std::sort(queued.begin(), queued.end(), EarlierArrival{ this });
+    return queued;
+}
+
 bool PriorityScheduler::hasJobs() const {
-    return !priorityQueue.empty();
+    return !priorityQueue.empty() || !agingQueue.empty() || !clampedQueue.empty();
 }
 
 void PriorityScheduler::schedule(int currentTime) {
-    applyAging(currentTime);
-    // Sort by priority, only those that have arrived
-    std::sort(priorityQueue.begin(), priorityQueue.end(),
-        [](const Job& a, const Job& b) {
-            return a.priority < b.priority;
-        });
+    INSTRUMENT_SCOPE(*counters, Phase::Aging);
+    if (lazyAging) settle(currentTime);
+    else applyAging(currentTime);
+}
+
+void PriorityScheduler::settle(int currentTime) {
+    // Only threshold and clamp crossings touch the heaps, and each job crosses
+    // each at most once, so lazy aging costs O(log n) per job instead of O(n)
+    // per decision
+    while (!agingStarts.empty()) {
+        JobHandle job = agingStarts.top();
+        if (agingFrom(job) >= currentTime) break;
+        agingStarts.pop();
+        priorityQueue.remove(job);
+        agingQueue.push(job);
+    }
+    while (!agingQueue.empty() &&
+           agingKeys[agingQueue.top()] - (long long)agingIncrement * currentTime <= 0) {
+        clampedQueue.push(agingQueue.pop());
+    }
+    lastAgingTime = currentTime;
 }
 
 void PriorityScheduler::applyAging(int currentTime) {
-    for (auto& job : priorityQueue) {
-        if (currentTime - job.arrivalTime > agingThreshold) {
-            job.priority -= agingIncrement; // Lower value = higher priority
-            if (job.priority < 0) job.priority = 0;
+    // Catch up on every time unit since the last call, so aging once per event
+    // gives the same priorities as aging once per tick
+    bool changed = false;
+    for (JobHandle job : priorityQueue.items()) {
+        int agedBefore = std::max(0, lastAgingTime - table->arrival(job) - agingThreshold);
+        int agedNow = std::max(0, currentTime - table->arrival(job) - agingThreshold);
+        if (agedNow > agedBefore) {
+            int& priority = priorities[job];
+            priority -= agingIncrement * (agedNow - agedBefore); // Lower value = higher priority
+            if (priority < 0) priority = 0;
+            changed = true;
         }
     }
+    if (changed) priorityQueue.rebuild();
+    lastAgingTime = currentTime;
 }
 
-PriorityScheduler::~PriorityScheduler() {}
+long long PriorityScheduler::agedPriority(JobHandle job, long long agedUpTo, long long at) const {
+    // Priority the job will have at time `at`, given its current value already
+    // includes aging up to `agedUpTo`
+    long long start = std::max(agedUpTo, agingFrom(job));
+    int priority = currentPriority(job);
+    if (at <= start) return priority;
+    return std::max(0LL, priority - (long long)agingIncrement * (at - start));
+}
 
-void PriorityScheduler::setJobs(const std::vector<Job>& jobs) {
-    priorityQueue = jobs;
-    std::sort(priorityQueue.begin(), priorityQueue.end(), [](const Job& a, const Job& b) {
-        return a.priority > b.priority;
-    });
-    scheduledJobs.clear();
-    timelineLog.clear();
+long long PriorityScheduler::overtakeTime(JobHandle challenger, JobHandle running, long long agedUpTo,
+                                          long long from, long long to) const {
+    // First time in [from, to] at which the waiting job outranks the running one,
+    // or -1. Both priorities are piecewise linear in time (flat, aging, clamped
+    // at 0), so each piece is solved directly instead of stepping through it.
+    long long need = EarlierArrival{ this }(challenger, running) ? 0 : -1;
+    auto gap = [&](long long at) {
+        return agedPriority(challenger, agedUpTo, at) - agedPriority(running, agedUpTo, at);
+    };
+
+    std::vector<long long> cuts = { from };
+    for (JobHandle job : { challenger, running }) {
+        long long start = std::max(agedUpTo, agingFrom(job));
+        cuts.push_back(start + 1);
+        if (agingIncrement > 0)
+            cuts.push_back(start + std::max(1LL, ((long long)currentPriority(job) + agingIncrement - 1) / agingIncrement));
+    }
+    std::sort(cuts.begin(), cuts.end());
+
+    for (size_t i = 0; i < cuts.size(); ++i) {
+        long long lo = std::max(cuts[i], from);
+        long long hi = std::min(i + 1 < cuts.size() ? cuts[i + 1] - 1 : to, to);
+        if (lo > hi) continue;
+        long long d = gap(lo);
+        if (d <= need) return lo;
+        if (lo == hi) continue;
+        long long step = gap(lo + 1) - d;
+        if (step >= 0) continue;
+        long long at = lo + (d - need + (-step) - 1) / (-step);
+        if (at <= hi) return at;
+    }
+    return -1;
 }
 
-std::string PriorityScheduler::getGanttChart() const {
-    std::ostringstream oss;
-    const std::string colors[] = { "\033[41m", "\033[42m", "\033[43m", "\033[44m", "\033[45m", "\033[46m", "\033[47m" };
-    oss << "Gantt Chart:\n";
-    oss << "Time:   ";
-    int time = 0;
-    for (const auto& job : scheduledJobs) {
-        oss << std::setw(4) << time << " ";
-        time += job.burstTime;
+int PriorityScheduler::timeSlice(JobHandle job, int currentTime) const {
+    // Keep running until a waiting job ages past the running one
+    long long end = (long long)currentTime + table->remaining(job);
+    // Until some job starts aging, a later threshold would decide the same way
+    long long firstAging = agingFrom(job);
+    if (!lazyAging) {
+        for (JobHandle other : priorityQueue.items()) {
+            firstAging = std::min(firstAging, agingFrom(other));
+            long long at = overtakeTime(other, job, currentTime, currentTime + 1, end - 1);
+            if (at != -1) end = at;
+        }
+        if (firstAging < end) sharedHorizon = (int)std::min<long long>(sharedHorizon, firstAging);
+        return (int)(end - currentTime);
     }
-    oss << std::setw(4) << time << "\n";
-    oss << "        ";
-    int colorIdx = 0;
-    time = 0;
-    for (const auto& job : scheduledJobs) {
-        std::string color = colors[colorIdx % 7];
-        oss << color << " " << job.getName() << " " << "\033[0m" << " ";
-        colorIdx++;
-        time += job.burstTime;
+    if (!agingStarts.empty()) firstAging = std::min(firstAging, agingFrom(agingStarts.top()));
+    if (!agingQueue.empty()) firstAging = std::min(firstAging, agingFrom(agingQueue.top()));
+    if (!clampedQueue.empty()) firstAging = std::min(firstAging, agingFrom(clampedQueue.top()));
+    if (firstAging < end) sharedHorizon = (int)std::min<long long>(sharedHorizon, firstAging);
+    // Up to the next threshold or clamp crossing only the heap tops can
+    // overtake; at the crossing the job is handed back and re-decided
+    if (!agingStarts.empty())
+        end = std::min(end, agingFrom(agingStarts.top()) + 1);
+    if (!agingQueue.empty())
+        end = std::min(end, (agingKeys[agingQueue.top()] + agingIncrement - 1) / agingIncrement);
+    // Lazy priorities carry no aging yet, so they age from their threshold
+    long long neverAged = std::numeric_limits<int>::min();
+    for (JobHandle other : { priorityQueue.empty() ? kNoJob : priorityQueue.top(),
+                             agingQueue.empty() ? kNoJob : agingQueue.top(),
+                             clampedQueue.empty() ? kNoJob : clampedQueue.top() }) {
+        if (other == kNoJob) continue;
+        long long at = overtakeTime(other, job, neverAged, currentTime + 1, end - 1);
+        if (at != -1) end = at;
     }
-    oss << "\n";
-    oss << "Labels: ";
-    for (const auto& job : scheduledJobs) {
-        oss << "[" << job.getName() << ":A=" << job.getArrivalTime() << ",B=" << job.burstTime << "] ";
+    return (int)(end - currentTime);
+}
+
+void PriorityScheduler::recycle(JobHandle job) {
+    // Eager aging keeps the aged priority; the next job starts from its own
+    if (job < priorities.size()) priorities[job] = std::numeric_limits<int>::min();
+}
+
+PriorityScheduler::~PriorityScheduler() {}
+
+void PriorityScheduler::attach(JobTable& jobs) {
+    priorityQueue.release();
+    agingQueue.release();
+    clampedQueue.release();
+    agingStarts.release();
+    releaseStorage(priorities);
+    releaseStorage(agingKeys);
+    Scheduler::attach(jobs);
+    lastAgingTime = -1;
+    sharedHorizon = std::numeric_limits<int>::max();
+}
+
+void PriorityScheduler::setJobs(const std::vector<Job>& jobs) {
+    attach(ownTable);
+    attachGantt(ownGantt);
+    ownTable.clear();
+    priorityQueue.reserve(jobs.size());
+    for (const auto& job : jobs) {
+        place(ownTable.add(job));
     }
-    oss << "\n";
-    return oss.str();
+}
+
+std::string PriorityScheduler::getGanttChart() const {
+    return gantt->render(*table);
 }
 
 std::string PriorityScheduler::getTimelineLog() const {
-    std::ostringstream oss;
-    oss << "Timeline Log:\n";
-    for (const auto& entry : timelineLog) {
-        oss << entry << "\n";
-    }
-    oss << "Legend: [A]=Arrival, [S]=Start, [C]=Completion, [P]=Preemption\n";
-    return oss.str();
+    return events->format(*table);
 }
 
 std::string PriorityScheduler::getStatistics() const {
-    std::ostringstream oss;
-    double totalWT = 0, totalTT = 0;
-    int count = scheduledJobs.size();
-    oss << std::left << std::setw(10) << "Job"
-        << std::setw(10) << "WT"
-        << std::setw(10) << "TT" << "\n";
-    for (const auto& job : scheduledJobs) {
-        oss << std::setw(10) << job.getName()
-            << std::setw(10) << job.waitingTime
-            << std::setw(10) << job.turnaroundTime << "\n";
-        totalWT += job.waitingTime;
-        totalTT += job.turnaroundTime;
-    }
-    if (count > 0) {
-        oss << "Avg WT: " << totalWT / count << "\n";
-        oss << "Avg TT: " << totalTT / count << "\n";
-    }
-    oss << "Total Jobs: " << count << "\n";
-    oss << "Total Burst Time: ";
-    int totalBurst = 0;
-    for (const auto& job : scheduledJobs) totalBurst += job.burstTime;
-    oss << totalBurst << "\n";
-    oss << "Algorithm: Priority\n";
-    oss << "Compare with other algorithms in Statistics menu.\n";
-    return oss.str();
+    return StatisticsEngine::report(*table, "Priority");
+}
+
+std::string PriorityScheduler::configKey() const {
+    // Lazy and eager aging make the same decisions, so they share results
+    return "Priority t=" + std::to_string(agingThreshold) + " i=" + std::to_string(agingIncrement);
 }
\ No newline at end of file
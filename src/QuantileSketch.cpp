@@ -0,0 +1,305 @@
+#include "../include/QuantileSketch.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+std::size_t logKey(std::uint32_t magnitude, double logGamma) {
+    if (magnitude <= 1) return 0;
+    return (std::size_t)std::ceil(std::log((double)magnitude) / logGamma);
+}
+
+// Most waiting and response times are small; their keys at the default
+// accuracy are looked up rather than paying for a log on every completion
+constexpr std::uint32_t kSmallMagnitudes = 4096;
+
+// More keys than any int32 magnitude needs at the finest accuracy
+constexpr std::uint64_t kMaxKeys = 1 << 20;
+
+void encodeStore(WireWriter& out, const std::vector<std::uint64_t>& store) {
+    std::size_t first = 0, last = store.size();
+    while (last > 0 && store[last - 1] == 0) --last;
+    while (first < last && store[first] == 0) ++first;
+    out.varint(first);
+    out.varint(last - first);
+    for (std::size_t k = first; k < last; ++k) out.varint(store[k]);
+}
+
+bool decodeStore(WireReader& in, std::vector<std::uint64_t>& store, std::uint64_t& count) {
+    std::uint64_t first = in.varint(), size = in.varint();
+    if (!in.ok() || first > kMaxKeys || size > kMaxKeys - first || size > in.remaining()) return false;
+    store.assign((std::size_t)(first + size), 0);
+    for (std::size_t k = (std::size_t)first; k < store.size(); ++k) count += store[k] = in.varint();
+    return in.ok();
+}
+
+const std::uint16_t* defaultSmallKeys() {
+    static const std::vector<std::uint16_t> keys = [] {
+        double a = QuantileSketch::kDefaultAccuracy;
+        double logGamma = std::log((1 + a) / (1 - a));
+        std::vector<std::uint16_t> k(kSmallMagnitudes);
+        for (std::uint32_t m = 0; m < kSmallMagnitudes; ++m) k[m] = (std::uint16_t)logKey(m, logGamma);
+        return k;
+    }();
+    return keys.data();
+}
+
+}
+
+QuantileSketch::QuantileSketch(double relativeAccuracy)
+    : alpha(std::min(0.5, std::max(1e-4, relativeAccuracy))),
+      gamma((1 + alpha) / (1 - alpha)), logGamma(std::log(gamma)),
+      smallKeys(alpha == kDefaultAccuracy ? defaultSmallKeys() : nullptr) {}
+
+std::size_t QuantileSketch::keyOf(std::uint32_t magnitude) const {
+    if (smallKeys && magnitude < kSmallMagnitudes) return smallKeys[magnitude];
+    return logKey(magnitude, logGamma);
+}
+
+// The point of bucket (gamma^(key-1), gamma^key] with the same relative
+// distance to both ends
+double QuantileSketch::valueOf(std::size_t key) const {
+    if (key == 0) return 1;
+    return 2 * std::pow(gamma, (double)key) / (gamma + 1);
+}
+
+void QuantileSketch::add(std::int32_t value) {
+    if (value == 0) {
+        ++zeros;
+    } else {
+        // Through int64 so that INT32_MIN has a magnitude
+        std::int64_t v = value;
+        std::vector<std::uint64_t>& store = v > 0 ? positive : negative;
+        std::size_t key = keyOf((std::uint32_t)(v > 0 ? v : -v));
+        if (key >= store.size()) store.resize(key + 1, 0);
+        ++store[key];
+    }
+    ++n;
+    lo = std::min(lo, value);
+    hi = std::max(hi, value);
+    total += value;
+    sumSquares += (double)value * value;
+}
+
+bool QuantileSketch::merge(const QuantileSketch& other) {
+    if (other.gamma != gamma) return false;
+    if (other.positive.size() > positive.size()) positive.resize(other.positive.size(), 0);
+    for (std::size_t k = 0; k < other.positive.size(); ++k) positive[k] += other.positive[k];
+    if (other.negative.size() > negative.size()) negative.resize(other.negative.size(), 0);
+    for (std::size_t k = 0; k < other.negative.size(); ++k) negative[k] += other.negative[k];
+    zeros += other.zeros;
+    n += other.n;
+    lo = std::min(lo, other.lo);
+    hi = std::max(hi, other.hi);
+    total += other.total;
+    sumSquares += other.sumSquares;
+    return true;
+}
+
+void QuantileSketch::clear() {
+    // Keeps the stores' capacity for the next round of samples
+    std::fill(positive.begin(), positive.end(), 0);
+    std::fill(negative.begin(), negative.end(), 0);
+    zeros = 0;
+    n = 0;
+    lo = std::numeric_limits<std::int32_t>::max();
+    hi = std::numeric_limits<std::int32_t>::min();
+    total = 0;
+    sumSquares = 0;
+}
+
+double QuantileSketch::variance() const {
+    if (n == 0) return 0;
+    double m = mean();
+    return std::max(0.0, sumSquares / n - m * m);
+}
+
+std::int32_t QuantileSketch::quantile(double q) const {
+    if (n == 0) return 0;
+    std::size_t rank = (std::size_t)std::ceil(std::min(1.0, std::max(0.0, q)) * n);
+    rank = rank == 0 ? 0 : rank - 1;
+    if (rank == 0) return lo;
+    if (rank + 1 >= (std::size_t)n) return hi;
+
+    // Walk the buckets in value order: negatives from the largest magnitude
+    // down, then zero, then positives up
+    double estimate = 0;
+    std::uint64_t seen = 0;
+    bool found = false;
+    for (std::size_t k = negative.size(); k-- > 0 && !found;) {
+        seen += negative[k];
+        if (rank < seen) { estimate = -valueOf(k); found = true; }
+    }
+    if (!found) {
+        seen += zeros;
+        found = rank < seen;
+    }
+    for (std::size_t k = 0; k < positive.size() && !found; ++k) {
+        seen += positive[k];
+        if (rank < seen) { estimate = valueOf(k); found = true; }
+    }
+    double rounded = std::round(estimate);
+    return (std::int32_t)std::min<double>(hi, std::max<double>(lo, rounded));
+}
+
+Distribution QuantileSketch::summary() const {
+    Distribution d;
+    d.count = n;
+    if (n == 0) return d;
+    d.min = lo;
+    d.max = hi;
+    d.mean = mean();
+    d.variance = variance();
+    d.p50 = quantile(0.50);
+    d.p95 = quantile(0.95);
+    d.p99 = quantile(0.99);
+    return d;
+}
+
+std::size_t QuantileSketch::memoryBytes() const {
+    return sizeof(*this) + (positive.capacity() + negative.capacity()) * sizeof(std::uint64_t);
+}
+
+void QuantileSketch::encode(WireWriter& out) const {
+    out.f64(alpha);
+    out.varint((std::uint64_t)n);
+    out.u32((std::uint32_t)lo);
+    out.u32((std::uint32_t)hi);
+    out.i64(total);
+    out.f64(sumSquares);
+    out.varint(zeros);
+    encodeStore(out, positive);
+    encodeStore(out, negative);
+}
+
+bool QuantileSketch::decode(WireReader& in) {
+    double accuracy = in.f64();
+    if (!in.ok() || !(accuracy >= 1e-4 && accuracy <= 0.5)) return false;
+    QuantileSketch sketch(accuracy);
+    std::uint64_t count = in.varint();
+    sketch.lo = (std::int32_t)in.u32();
+    sketch.hi = (std::int32_t)in.u32();
+    sketch.total = in.i64();
+    sketch.sumSquares = in.f64();
+    sketch.zeros = in.varint();
+    std::uint64_t buckets = sketch.zeros;
+    if (!in.ok() || !decodeStore(in, sketch.positive, buckets) || !decodeStore(in, sketch.negative, buckets))
+        return false;
+    // Bucket counts must add up to the sample count, and extremes must be
+    // ordered when there are samples
+    if (count > (std::uint64_t)std::numeric_limits<long long>::max() || buckets != count) return false;
+    sketch.n = (long long)count;
+    if (sketch.n > 0 && sketch.lo > sketch.hi) return false;
+    if (sketch.n == 0) {
+        sketch.lo = std::numeric_limits<std::int32_t>::max();
+        sketch.hi = std::numeric_limits<std::int32_t>::min();
+    }
+    *this = std::move(sketch);
+    return true;
+}
+
+void RunSketches::admit(const JobTable& jobs, JobHandle job) {
+    deadlineJobs += jobs.hasDeadline(job);
+}
+
+void RunSketches::finish(const JobTable& jobs, JobHandle job) {
+    waiting.add(jobs.waiting(job));
+    turnaround.add(jobs.turnaround(job));
+    response.add(jobs.start(job) - jobs.arrival(job));
+    totalBurst += jobs.burst(job);
+    firstArrival = std::min(firstArrival, (long long)std::max(0, jobs.arrival(job)));
+    lastCompletion = std::max(lastCompletion, (long long)jobs.completion(job));
+    if (jobs.hasDeadline(job)) {
+        int late = jobs.lateness(job);
+        lateness.add(late);
+        deadlineLate += late > 0;
+    }
+}
+
+bool RunSketches::merge(const RunSketches& other) {
+    if (other.waiting.accuracy() != waiting.accuracy() || other.turnaround.accuracy() != turnaround.accuracy() ||
+        other.response.accuracy() != response.accuracy() || other.lateness.accuracy() != lateness.accuracy())
+        return false;
+    waiting.merge(other.waiting);
+    turnaround.merge(other.turnaround);
+    response.merge(other.response);
+    lateness.merge(other.lateness);
+    totalBurst += other.totalBurst;
+    firstArrival = std::min(firstArrival, other.firstArrival);
+    lastCompletion = std::max(lastCompletion, other.lastCompletion);
+    deadlineJobs += other.deadlineJobs;
+    deadlineLate += other.deadlineLate;
+    return true;
+}
+
+bool RunSketches::mergeShard(const RunSketches& other) {
+    long long span = makespan() + other.makespan();
+    if (!merge(other)) return false;
+    shardMakespan = span;
+    return true;
+}
+
+long long RunSketches::makespan() const {
+    if (shardMakespan > 0) return shardMakespan;
+    return turnaround.count() > 0 ? lastCompletion - firstArrival : 0;
+}
+
+void RunSketches::encode(WireWriter& out) const {
+    waiting.encode(out);
+    turnaround.encode(out);
+    response.encode(out);
+    lateness.encode(out);
+    out.i64(totalBurst);
+    out.i64(firstArrival);
+    out.i64(lastCompletion);
+    out.i64(deadlineJobs);
+    out.i64(deadlineLate);
+    out.i64(shardMakespan);
+}
+
+bool RunSketches::decode(WireReader& in) {
+    RunSketches sketches;
+    if (!sketches.waiting.decode(in) || !sketches.turnaround.decode(in) || !sketches.response.decode(in) ||
+        !sketches.lateness.decode(in))
+        return false;
+    sketches.totalBurst = in.i64();
+    sketches.firstArrival = in.i64();
+    sketches.lastCompletion = in.i64();
+    sketches.deadlineJobs = in.i64();
+    sketches.deadlineLate = in.i64();
+    sketches.shardMakespan = in.i64();
+    if (!in.ok() || sketches.shardMakespan < 0) return false;
+    *this = std::move(sketches);
+    return true;
+}
+
+RunStatistics RunSketches::statistics() const {
+    RunStatistics stats;
+    stats.jobs = turnaround.count();
+    stats.waiting = waiting.summary();
+    stats.turnaround = turnaround.summary();
+    stats.response = response.summary();
+    stats.totalBurst = totalBurst;
+    stats.deadlineJobs = deadlineJobs;
+    stats.deadlineUnfinished = std::max(0LL, deadlineJobs - lateness.count());
+    stats.deadlineMisses = deadlineLate + stats.deadlineUnfinished;
+    if (stats.deadlineJobs > 0) stats.deadlineMissRate = (double)stats.deadlineMisses / stats.deadlineJobs;
+    stats.lateness = lateness.summary();
+    if (stats.jobs > 0) {
+        stats.makespan = makespan();
+        if (stats.makespan > 0) {
+            stats.throughput = (double)stats.jobs / stats.makespan;
+            stats.cpuUtilization = (double)stats.totalBurst / stats.makespan;
+        }
+    }
+    return stats;
+}
+
+RunSketches RunSketches::fromTable(const JobTable& jobs) {
+    RunSketches sketches;
+    for (JobHandle job = 0; job < (JobHandle)jobs.size(); ++job) {
+        sketches.admit(jobs, job);
+        if (jobs.finished(job)) sketches.finish(jobs, job);
+    }
+    return sketches;
+}
\ No newline at end of file
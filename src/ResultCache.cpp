@@ -0,0 +1,219 @@
+#include "../include/ResultCache.h"
+#include "../include/TraceFile.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <thread>
+
+namespace {
+
+// Changes whenever the hashed fields do, so old disk entries stop matching
+constexpr std::uint64_t kHashSeed = 0x4a4f425345543031ull;
+
+inline std::uint64_t mix(std::uint64_t h, std::uint64_t v) {
+    h ^= v * 0x9E3779B97F4A7C15ull;
+    h = (h << 31) | (h >> 33);
+    return h * 0xBF58476D1CE4E5B9ull;
+}
+
+inline std::uint64_t pack(std::int32_t a, std::int32_t b) {
+    return (std::uint64_t)(std::uint32_t)a << 32 | (std::uint32_t)b;
+}
+
+std::uint64_t hashString(const std::string& s) {
+    std::uint64_t h = 0xcbf29ce484222325ull;   // FNV-1a
+    for (unsigned char c : s) h = (h ^ c) * 0x100000001b3ull;
+    return h;
+}
+
+std::string hex(std::uint64_t v) {
+    char text[17];
+    std::snprintf(text, sizeof text, "%016llx", (unsigned long long)v);
+    return text;
+}
+
+// The config key a disk entry was stored under, kept beside its trace
+std::string configPathFor(const std::string& tracePath) {
+    return tracePath + ".config";
+}
+
+bool readConfig(const std::string& path, std::string& config) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    config.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return !in.bad();
+}
+
+// Under a temporary name and renamed, like the trace
+bool writeConfig(const std::string& path, const std::string& temporary, const std::string& config) {
+    std::error_code ec;
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        if (!(out << config) || !out.flush()) {
+            out.close();
+            std::filesystem::remove(temporary, ec);
+            return false;
+        }
+    }
+    std::filesystem::rename(temporary, path, ec);
+    if (ec) std::filesystem::remove(temporary, ec);
+    return !ec;
+}
+
+}
+
+ResultCache::ResultCache(std::size_t memoryBudget) : budget(memoryBudget) {}
+
+std::uint64_t ResultCache::hashJobs(const SharedJobSet& jobs) {
+    const JobTable& table = jobs.table();
+    std::uint64_t h = mix(kHashSeed, jobs.size());
+    for (JobHandle job : jobs.arrivalOrder()) {
+        std::string_view name = table.name(job);
+        h = mix(h, pack(table.id(job), table.arrival(job)));
+        h = mix(h, pack(table.burst(job), table.priority(job)));
+        h = mix(h, pack(table.deadline(job), (std::int32_t)name.size()));
+        for (std::size_t i = 0; i < name.size(); i += 8) {
+            std::uint64_t chunk = 0;
+            std::memcpy(&chunk, name.data() + i, std::min<std::size_t>(8, name.size() - i));
+            h = mix(h, chunk);
+        }
+    }
+    return h;
+}
+
+void ResultCache::setDirectory(std::string directory) {
+    std::lock_guard<std::mutex> lock(mutex);
+    storeDirectory = std::move(directory);
+}
+
+std::shared_ptr<const CachedRun> ResultCache::find(const SharedJobSet& jobs, std::uint64_t jobsHash,
+                                                   const std::string& config) {
+    if (config.empty()) return nullptr;
+    Key key(jobsHash, config);
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(key);
+        if (it != entries.end() && matches(*it->second.run, jobs)) {
+            recency.splice(recency.begin(), recency, it->second.recent);
+            ++counts.hits;
+            return it->second.run;
+        }
+        if (storeDirectory.empty()) {
+            ++counts.misses;
+            return nullptr;
+        }
+        path = pathFor(jobsHash, config);
+    }
+
+    // Read outside the lock; another thread may load the same file meanwhile,
+    // and insert() keeps whichever lands last. The file name only carries a
+    // hash of the config, so the stored key is compared as well.
+    auto run = std::make_shared<CachedRun>();
+    run->config = config;
+    std::string stored, error;
+    bool loaded = readConfig(configPathFor(path), stored) && stored == config &&
+                  TraceFile::readSchedule(path, run->jobs, run->gantt, error) && matches(*run, jobs);
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!loaded) {
+        ++counts.misses;
+        return nullptr;
+    }
+    ++counts.hits;
+    ++counts.diskHits;
+    insert(key, run);
+    return run;
+}
+
+std::shared_ptr<const CachedRun> ResultCache::store(std::uint64_t jobsHash, const std::string& config,
+                                                    const JobTable& jobs, const GanttChart& gantt) {
+    auto run = std::make_shared<const CachedRun>(CachedRun{ config, JobTable(jobs), GanttChart(gantt) });
+    if (config.empty()) return run;
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        insert(Key(jobsHash, config), run);
+        if (storeDirectory.empty()) return run;
+        path = pathFor(jobsHash, config);
+    }
+
+    // Written under a temporary name and renamed, so a reader never maps a
+    // half-written trace; the store is best effort and failures are dropped.
+    // The config key goes first: a trace is only used next to its key.
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+    std::ostringstream temporary;
+    temporary << path << ".tmp" << std::this_thread::get_id();
+    std::string error;
+    if (!writeConfig(configPathFor(path), temporary.str() + ".config", config)) return run;
+    if (TraceFile::writeSchedule(temporary.str(), run->jobs, run->gantt, error))
+        std::filesystem::rename(temporary.str(), path, ec);
+    else
+        std::filesystem::remove(temporary.str(), ec);
+    return run;
+}
+
+void ResultCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    recency.clear();
+    used = 0;
+}
+
+ResultCache::Stats ResultCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    Stats result = counts;
+    result.entries = entries.size();
+    result.bytes = used;
+    return result;
+}
+
+void ResultCache::insert(const Key& key, std::shared_ptr<const CachedRun> run) {
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        used -= it->second.bytes;
+        recency.erase(it->second.recent);
+        entries.erase(it);
+    }
+    std::size_t bytes = footprint(*run);
+    if (bytes > budget) return;
+    while (used + bytes > budget) {
+        auto oldest = entries.find(recency.back());
+        used -= oldest->second.bytes;
+        entries.erase(oldest);
+        recency.pop_back();
+    }
+    recency.push_front(key);
+    entries.emplace(key, Entry{ std::move(run), bytes, recency.begin() });
+    used += bytes;
+}
+
+std::string ResultCache::pathFor(std::uint64_t jobsHash, const std::string& config) const {
+    return (std::filesystem::path(storeDirectory) / (hex(jobsHash) + "-" + hex(hashString(config)) + ".jstrace")).string();
+}
+
+bool ResultCache::matches(const CachedRun& run, const SharedJobSet& jobs) {
+    const JobTable& cached = run.jobs;
+    const JobTable& table = jobs.table();
+    const std::vector<JobHandle>& order = jobs.arrivalOrder();
+    if (cached.size() != order.size()) return false;
+    for (JobHandle h = 0; h < cached.size(); ++h) {
+        JobHandle job = order[h];
+        if (cached.id(h) != table.id(job) || cached.arrival(h) != table.arrival(job) ||
+            cached.burst(h) != table.burst(job) || cached.priority(h) != table.priority(job) ||
+            cached.deadline(h) != table.deadline(job) || cached.name(h) != table.name(job))
+            return false;
+    }
+    return true;
+}
+
+std::size_t ResultCache::footprint(const CachedRun& run) {
+    // Eight int32 columns and a name offset per job, the name pool, the segments
+    return sizeof(CachedRun) + run.config.size() +
+           run.jobs.size() * (8 * sizeof(std::int32_t) + sizeof(std::size_t)) +
+           run.jobs.namePoolData().size() + run.gantt.size() * sizeof(GanttSegment);
+}
\ No newline at end of file
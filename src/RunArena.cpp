@@ -0,0 +1,42 @@
+#include "../include/RunArena.h"
+#include <algorithm>
+
+void* RunArena::Overflow::do_allocate(std::size_t size, std::size_t align) {
+    bytes += size;
+    return std::pmr::new_delete_resource()->allocate(size, align);
+}
+
+void RunArena::Overflow::do_deallocate(void* p, std::size_t size, std::size_t align) {
+    std::pmr::new_delete_resource()->deallocate(p, size, align);
+}
+
+RunArena::RunArena(std::size_t initialBytes)
+    : buffer(std::max<std::size_t>(initialBytes, 1024)),
+      arena(std::make_unique<std::pmr::monotonic_buffer_resource>(buffer.data(), buffer.size(), &overflow)) {}
+
+void RunArena::release() {
+    if (overflow.bytes == 0 || buffer.size() >= kMaxRetainedBytes) {
+        arena->release();
+        overflow.bytes = 0;
+        return;
+    }
+    // The run spilled past the buffer: grow it so a run that size fits next time
+    std::size_t grown = std::min(kMaxRetainedBytes, buffer.size() + overflow.bytes);
+    arena.reset();
+    overflow.bytes = 0;
+    buffer = std::vector<std::byte>((grown + 4095) & ~std::size_t(4095));
+    arena = std::make_unique<std::pmr::monotonic_buffer_resource>(buffer.data(), buffer.size(), &overflow);
+}
+
+RunArena& RunArena::local() {
+    thread_local RunArena arena;
+    return arena;
+}
+
+RunArena::Scope::Scope() : owner(local()) {
+    ++owner.depth;
+}
+
+RunArena::Scope::~Scope() {
+    if (--owner.depth == 0) owner.release();
+}
\ No newline at end of file
@@ -1,63 +1,297 @@
 #include "../include/Simulator.h"
+#include "../include/Statistics.h"
+#include "../include/GanttRenderer.h"
+#include "../include/FCFSScheduler.h"
+#include "../include/SJFScheduler.h"
+#include "../include/RoundRobinScheduler.h"
+#include "../include/PriorityScheduler.h"
 #include <iostream>
 #include <iomanip>
+#include <sstream>
+#include <algorithm>
 
-Simulator::Simulator(std::unique_ptr<Scheduler> sched, std::vector<Job> jobs)
-    : currentTime(0), scheduler(std::move(sched)), allJobs(std::move(jobs)) {}
+Simulator::Simulator(std::unique_ptr<Scheduler> sched, std::vector<Job> jobs, std::pmr::memory_resource* memory)
+    : currentTime(0), countedMemory(memory, counters), scheduler(std::move(sched)),
+      arrivals(std::make_unique<VectorArrivalSource>(std::move(jobs))),
+      jobs(runMemory(memory)), finishedJobs(runMemory(memory)), ganttChart(runMemory(memory)),
+      events(runMemory(memory)), preempted(kNoJob), lastDispatched(kNoJob) {
+    attachScheduler();
+}
+
+Simulator::Simulator(std::unique_ptr<Scheduler> sched, std::unique_ptr<ArrivalSource> source,
+                     std::pmr::memory_resource* memory)
+    : currentTime(0), countedMemory(memory, counters), scheduler(std::move(sched)), arrivals(std::move(source)),
+      jobs(runMemory(memory)), finishedJobs(runMemory(memory)), ganttChart(runMemory(memory)),
+      events(runMemory(memory)), preempted(kNoJob), lastDispatched(kNoJob) {
+    attachScheduler();
+}
+
+Simulator::Simulator(std::unique_ptr<Scheduler> sched, std::shared_ptr<const SharedJobSet> set,
+                     const SimulatorCheckpoint& from, std::pmr::memory_resource* memory)
+    : currentTime(from.time), countedMemory(memory, counters), scheduler(std::move(sched)),
+      arrivals(std::make_unique<SharedArrivalSource>(std::move(set), from.jobs.size())),
+      jobs(from.jobs, runMemory(memory)),
+      finishedJobs(from.finished.begin(), from.finished.end(), runMemory(memory)),
+      ganttChart(from.gantt, runMemory(memory)), events(from.events, runMemory(memory)),
+      preempted(from.preempted), lastDispatched(kNoJob) {
+    attachScheduler();
+    for (JobHandle job : from.queued) scheduler->enqueue(job);
+    if (from.sketches) sketches = std::make_unique<RunSketches>(*from.sketches);
+    INSTRUMENT(counters.queueLength = counters.queueHighWater = from.queued.size());
+}
+
+Simulator::Simulator(std::unique_ptr<Scheduler> sched, std::shared_ptr<const SharedJobSet> set,
+                     SimulatorCheckpoint&& from, std::pmr::memory_resource* memory)
+    : currentTime(from.time), countedMemory(memory, counters), scheduler(std::move(sched)),
+      arrivals(std::make_unique<SharedArrivalSource>(std::move(set), from.jobs.size())),
+      jobs(std::move(from.jobs), runMemory(memory)),
+      finishedJobs(from.finished.begin(), from.finished.end(), runMemory(memory)),
+      ganttChart(std::move(from.gantt), runMemory(memory)), events(std::move(from.events), runMemory(memory)),
+      preempted(from.preempted), lastDispatched(kNoJob) {
+    attachScheduler();
+    for (JobHandle job : from.queued) scheduler->enqueue(job);
+    if (from.sketches) sketches = std::make_unique<RunSketches>(*from.sketches);
+    INSTRUMENT(counters.queueLength = counters.queueHighWater = from.queued.size());
+}
+
+void Simulator::attachScheduler() {
+    scheduler->attach(jobs);
+    scheduler->attachGantt(ganttChart);
+    scheduler->attachEvents(events);
+    scheduler->attachCounters(counters);
+    loop = loopFor(*scheduler);
+}
+
+Simulator::Loop Simulator::loopFor(Scheduler& scheduler) {
+    // The built-ins are final, so a match here is the exact type
+    if (dynamic_cast<FCFSScheduler*>(&scheduler)) return &runLoop<FCFSScheduler>;
+    if (dynamic_cast<SJFScheduler*>(&scheduler)) return &runLoop<SJFScheduler>;
+    if (dynamic_cast<RoundRobinScheduler*>(&scheduler)) return &runLoop<RoundRobinScheduler>;
+    if (dynamic_cast<PriorityScheduler*>(&scheduler)) return &runLoop<PriorityScheduler>;
+    return &runLoop<Scheduler>;
+}
+
+template <typename Policy>
+bool Simulator::runLoop(Simulator& sim, bool once) {
+    Policy& policy = static_cast<Policy&>(*sim.scheduler);
+    if (once) return sim.stepWith(policy);
+    while (sim.stepWith(policy)) {}
+    return false;
+}
 
 void Simulator::run() {
-    while (!allJobs.empty() || scheduler->hasJobs()) {
-        // Add jobs that have arrived to the scheduler
-        for (auto it = allJobs.begin(); it != allJobs.end();) {
-            if (it->arrivalTime <= currentTime) {
-                scheduler->addJob(*it);
-                it = allJobs.erase(it);
-            } else {
-                ++it;
-            }
+    loop(*this, false);
+}
+
+bool Simulator::step() {
+    return loop(*this, true);
+}
+
+template <typename Policy>
+bool Simulator::stepWith(Policy& policy) {
+    // Event-driven: each dispatch runs the job up to the next point where the
+    // outcome could change (completion, end of the scheduler's slice, or an
+    // arrival under a preemptive policy), rather than one time unit at a time.
+    if (!arrivals->hasNext() && !policy.hasJobs()) return false;
+    admitArrivals(policy, currentTime);
+    if (retirement) retireRejected();
+    bool ready;
+    {
+        INSTRUMENT_SCOPE(counters, Phase::HasJobs);
+        ready = policy.hasJobs();
+    }
+    if (!ready) {
+        INSTRUMENT(counters.queueLength = 0);
+        // A policy with admission control may have turned the last arrival away
+        if (arrivals->hasNext()) {
+            currentTime = nextArrivalTime();
+            INSTRUMENT(++counters.idleJumps);
+        }
+        return true;
+    }
+    {
+        INSTRUMENT_SCOPE(counters, Phase::Schedule);
+        policy.schedule(currentTime);
+    }
+
+    JobHandle job;
+    {
+        INSTRUMENT_SCOPE(counters, Phase::Dequeue);
+        job = policy.dequeue();
+    }
+    INSTRUMENT(countDispatch(job));
+    int remaining = jobs.remaining(job);
+    int sliceEnd = currentTime + std::max(0, remaining);
+    if (remaining > 0) {
+        int slice;
+        {
+            INSTRUMENT_SCOPE(counters, Phase::TimeSlice);
+            slice = policy.timeSlice(job, currentTime);
         }
-        scheduler->schedule(currentTime);
-
-        if (scheduler->hasJobs()) {
-            Job job = scheduler->getNextJob();
-            if (job.startTime == -1) job.startTime = currentTime;
-            ganttChart.push_back({job.jobId, currentTime});
-            job.remainingTime--;
-            currentTime++;
-            if (job.remainingTime == 0) {
-                job.completionTime = currentTime;
-                job.calculateMetrics();
-                finishedJobs.push_back(job);
-            } else {
-                scheduler->addJob(job);
-            }
-        } else {
-            currentTime++;
+        slice = std::max(1, std::min(slice, remaining));
+        sliceEnd = currentTime + slice;
+        if (policy.preemptsOnArrival() && arrivals->hasNext())
+            sliceEnd = std::min(sliceEnd, nextArrivalTime());
+    }
+    {
+        INSTRUMENT_SCOPE(counters, Phase::Bookkeeping);
+        if (job != preempted) {
+            if (preempted != kNoJob) events.record(currentTime, preempted, EventType::Preempt);
+            events.record(currentTime, job, jobs.start(job) == -1 ? EventType::Start : EventType::Resume);
         }
+        preempted = kNoJob;
+        if (jobs.start(job) == -1) jobs.setStart(job, currentTime);
+        ganttChart.record(job, currentTime, sliceEnd - currentTime);
+        jobs.setRemaining(job, remaining - (sliceEnd - currentTime));
     }
+    // Jobs that arrived while this one was running queue up ahead of it
+    admitArrivals(policy, sliceEnd - 1);
+    currentTime = sliceEnd;
+    if (jobs.remaining(job) <= 0) {
+        INSTRUMENT_SCOPE(counters, Phase::Bookkeeping);
+        jobs.complete(job, currentTime);
+        events.record(currentTime, job, EventType::Complete);
+        INSTRUMENT(++counters.completions);
+        if (sketches) sketches->finish(jobs, job);
+        if (retirement) retire(job);
+        else finishedJobs.push_back(job);
+    } else {
+        {
+            INSTRUMENT_SCOPE(counters, Phase::Enqueue);
+            policy.enqueue(job);
+        }
+        INSTRUMENT(countQueued());
+        preempted = job;
+    }
+    return true;
+}
+
+void Simulator::setSketching(bool enabled) {
+    if (!enabled) sketches.reset();
+    else if (!sketches) sketches = std::make_unique<RunSketches>();
+}
+
+void Simulator::retire(JobHandle job) {
+    scheduler->recycle(job);
+    retirement->retire(jobs, job, currentTime);
+}
+
+void Simulator::retireRejected() {
+    scheduler->takeRejected(turnedAway);
+    for (JobHandle job : turnedAway) retire(job);
+    turnedAway.clear();
+}
+
+void Simulator::countDispatch(JobHandle job) {
+    ++counters.dispatches;
+    if (counters.queueLength > 0) --counters.queueLength;
+    if (job != lastDispatched) ++counters.contextSwitches;
+    if (preempted != kNoJob && preempted != job) ++counters.preemptions;
+    lastDispatched = job;
+}
+
+void Simulator::countQueued() {
+    counters.queueHighWater = std::max(counters.queueHighWater, ++counters.queueLength);
+}
+
+SimulatorCheckpoint Simulator::checkpoint() const {
+    SimulatorCheckpoint cp;
+    cp.time = currentTime;
+    cp.jobs = jobs;
+    cp.gantt = ganttChart;
+    cp.events = events;
+    cp.preempted = preempted;
+    cp.finished.assign(finishedJobs.begin(), finishedJobs.end());
+    cp.queued = scheduler->queuedJobs();
+    if (sketches) cp.sketches = std::make_shared<RunSketches>(*sketches);
+    return cp;
+}
+
+SimulatorCheckpoint Simulator::releaseCheckpoint() {
+    SimulatorCheckpoint cp;
+    cp.time = currentTime;
+    cp.queued = scheduler->queuedJobs();
+    cp.jobs = std::move(jobs);
+    cp.gantt = std::move(ganttChart);
+    cp.events = std::move(events);
+    cp.preempted = preempted;
+    cp.finished.assign(finishedJobs.begin(), finishedJobs.end());
+    cp.sketches = std::move(sketches);
+    return cp;
+}
+
+SimulatorMark Simulator::mark() const {
+    SimulatorMark m;
+    m.time = currentTime;
+    m.admitted = jobs.size();
+    m.segments = ganttChart.size();
+    m.lastSegmentLength = ganttChart.empty() ? 0 : ganttChart.segments().back().length;
+    m.events = events.size();
+    m.finished = finishedJobs.size();
+    m.queued = scheduler->queuedJobs();
+    m.queuedRemaining.reserve(m.queued.size());
+    m.queuedStart.reserve(m.queued.size());
+    for (JobHandle job : m.queued) {
+        m.queuedRemaining.push_back(jobs.remaining(job));
+        m.queuedStart.push_back(jobs.start(job));
+    }
+    m.preempted = preempted;
+    return m;
+}
+
+SimulatorCheckpoint Simulator::checkpointAt(const SimulatorMark& mark) const {
+    SimulatorCheckpoint cp;
+    cp.time = mark.time;
+    // Every job admitted by then is either finished for good or still queued
+    cp.jobs = JobTable(jobs, mark.admitted, std::pmr::get_default_resource());
+    for (std::size_t i = 0; i < mark.queued.size(); ++i) {
+        JobHandle job = mark.queued[i];
+        cp.jobs.setRemaining(job, mark.queuedRemaining[i]);
+        cp.jobs.setStart(job, mark.queuedStart[i]);
+        cp.jobs.complete(job, -1);
+    }
+    cp.gantt = ganttChart;
+    cp.gantt.truncate(mark.segments, mark.lastSegmentLength);
+    cp.events = EventLog(events, mark.events, std::pmr::get_default_resource());
+    cp.finished.assign(finishedJobs.begin(), finishedJobs.begin() + mark.finished);
+    cp.queued = mark.queued;
+    cp.preempted = mark.preempted;
+    return cp;
+}
+
+template <typename Policy>
+void Simulator::admitArrivals(Policy& policy, int upTo) {
+    while (arrivals->hasNext() && arrivals->peekArrivalTime() <= upTo) {
+        JobHandle job;
+        {
+            INSTRUMENT_SCOPE(counters, Phase::Admission);
+            job = arrivals->admit(jobs);
+            events.record(jobs.arrival(job), job, EventType::Arrive);
+            if (sketches) sketches->admit(jobs, job);
+        }
+        {
+            INSTRUMENT_SCOPE(counters, Phase::Enqueue);
+            policy.enqueue(job);
+        }
+        INSTRUMENT(++counters.arrivals; countQueued());
+    }
+}
+
+int Simulator::nextArrivalTime() {
+    return arrivals->peekArrivalTime();
 }
 
 void Simulator::reportMetrics() const {
-    double totalTurnaround = 0, totalWaiting = 0;
-    for (const auto& job : finishedJobs) {
-        job.display();
-        totalTurnaround += job.turnaroundTime;
-        totalWaiting += job.waitingTime;
+    for (JobHandle h : finishedJobs) {
+        jobs.toJob(h).display();
     }
-    int n = finishedJobs.size();
+    RunStatistics stats = StatisticsEngine::compute(jobs);
     std::cout << std::fixed << std::setprecision(2);
-    std::cout << "Average Turnaround Time: " << (n ? totalTurnaround / n : 0) << std::endl;
-    std::cout << "Average Waiting Time: " << (n ? totalWaiting / n : 0) << std::endl;
+    std::cout << "Average Turnaround Time: " << stats.turnaround.mean << std::endl;
+    std::cout << "Average Waiting Time: " << stats.waiting.mean << std::endl;
+    std::cout << StatisticsEngine::formatSummary(stats);
 }
 
 void Simulator::printGanttChart() const {
-    std::cout << "Gantt Chart:\n|";
-    for (const auto& entry : ganttChart) {
-        std::cout << " J" << entry.first << " |";
-    }
-    std::cout << std::endl << " ";
-    for (size_t i = 0; i <= ganttChart.size(); ++i) {
-        std::cout << std::setw(3) << i;
-    }
-    std::cout << std::endl;
+    GanttRenderer::print(ganttChart, jobs);
 }
\ No newline at end of file
@@ -0,0 +1,250 @@
+#include "../include/Statistics.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+struct Moments {
+    long long sum = 0;
+    double sumSquares = 0;
+    int min = std::numeric_limits<int>::max();
+    int max = std::numeric_limits<int>::min();
+};
+
+void scalarMoments(const std::int32_t* v, std::size_t from, std::size_t n, Moments& m) {
+    for (std::size_t i = from; i < n; ++i) {
+        m.sum += v[i];
+        m.sumSquares += (double)v[i] * v[i];
+        m.min = std::min(m.min, (int)v[i]);
+        m.max = std::max(m.max, (int)v[i]);
+    }
+}
+
+Moments moments(const std::int32_t* v, std::size_t n) {
+    Moments m;
+    std::size_t i = 0;
+#if defined(__AVX2__)
+    __m256i vmin = _mm256_set1_epi32(std::numeric_limits<int>::max());
+    __m256i vmax = _mm256_set1_epi32(std::numeric_limits<int>::min());
+    __m256i sumLo = _mm256_setzero_si256(), sumHi = _mm256_setzero_si256();
+    __m256d sqLo = _mm256_setzero_pd(), sqHi = _mm256_setzero_pd();
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(v + i));
+        vmin = _mm256_min_epi32(vmin, x);
+        vmax = _mm256_max_epi32(vmax, x);
+        __m128i lo = _mm256_castsi256_si128(x);
+        __m128i hi = _mm256_extracti128_si256(x, 1);
+        sumLo = _mm256_add_epi64(sumLo, _mm256_cvtepi32_epi64(lo));
+        sumHi = _mm256_add_epi64(sumHi, _mm256_cvtepi32_epi64(hi));
+        __m256d dlo = _mm256_cvtepi32_pd(lo), dhi = _mm256_cvtepi32_pd(hi);
+        sqLo = _mm256_add_pd(sqLo, _mm256_mul_pd(dlo, dlo));
+        sqHi = _mm256_add_pd(sqHi, _mm256_mul_pd(dhi, dhi));
+    }
+    alignas(32) std::int32_t lanes[8];
+    alignas(32) long long sums[4];
+    alignas(32) double squares[4];
+    _mm256_store_si256((__m256i*)lanes, vmin);
+    for (int lane : lanes) m.min = std::min(m.min, lane);
+    _mm256_store_si256((__m256i*)lanes, vmax);
+    for (int lane : lanes) m.max = std::max(m.max, lane);
+    _mm256_store_si256((__m256i*)sums, _mm256_add_epi64(sumLo, sumHi));
+    for (long long s : sums) m.sum += s;
+    _mm256_store_pd(squares, _mm256_add_pd(sqLo, sqHi));
+    for (double s : squares) m.sumSquares += s;
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    int32x4_t vmin = vdupq_n_s32(std::numeric_limits<int>::max());
+    int32x4_t vmax = vdupq_n_s32(std::numeric_limits<int>::min());
+    int64x2_t sum = vdupq_n_s64(0);
+    float64x2_t sqLo = vdupq_n_f64(0), sqHi = vdupq_n_f64(0);
+    for (; i + 4 <= n; i += 4) {
+        int32x4_t x = vld1q_s32(v + i);
+        vmin = vminq_s32(vmin, x);
+        vmax = vmaxq_s32(vmax, x);
+        sum = vpadalq_s32(sum, x);
+        float64x2_t dlo = vcvtq_f64_s64(vmovl_s32(vget_low_s32(x)));
+        float64x2_t dhi = vcvtq_f64_s64(vmovl_s32(vget_high_s32(x)));
+        sqLo = vfmaq_f64(sqLo, dlo, dlo);
+        sqHi = vfmaq_f64(sqHi, dhi, dhi);
+    }
+    m.min = std::min(m.min, (int)vminvq_s32(vmin));
+    m.max = std::max(m.max, (int)vmaxvq_s32(vmax));
+    m.sum += vaddvq_s64(sum);
+    m.sumSquares += vaddvq_f64(vaddq_f64(sqLo, sqHi));
+#endif
+    scalarMoments(v, i, n, m);
+    return m;
+}
+
+std::size_t percentileRank(std::size_t n, double p) {
+    std::size_t r = (std::size_t)std::ceil(p * n);
+    return r == 0 ? 0 : r - 1;
+}
+
+// Nearest-rank percentiles. Scheduling metrics usually span a range not much
+// wider than the job count, so a counting pass answers all three at once;
+// wide ranges fall back to successive selection. Either way O(n), no sort.
+// May reorder `values`.
+void percentiles(std::vector<std::int32_t>& values, Distribution& d) {
+    std::size_t n = values.size();
+    std::size_t k50 = percentileRank(n, 0.50), k95 = percentileRank(n, 0.95), k99 = percentileRank(n, 0.99);
+    std::size_t range = (std::size_t)((long long)d.max - d.min) + 1;
+    if (range <= 4 * n + 1024) {
+        std::vector<std::uint32_t> counts(range, 0);
+        for (std::int32_t v : values) ++counts[v - d.min];
+        std::size_t seen = 0;
+        int* targets[3] = { &d.p50, &d.p95, &d.p99 };
+        std::size_t ranks[3] = { k50, k95, k99 };
+        int next = 0;
+        for (std::size_t bucket = 0; bucket < range && next < 3; ++bucket) {
+            seen += counts[bucket];
+            while (next < 3 && ranks[next] < seen) *targets[next++] = d.min + (int)bucket;
+        }
+        return;
+    }
+    std::nth_element(values.begin(), values.begin() + k99, values.end());
+    d.p99 = values[k99];
+    std::nth_element(values.begin(), values.begin() + k95, values.begin() + k99 + 1);
+    d.p95 = values[k95];
+    std::nth_element(values.begin(), values.begin() + k50, values.begin() + k95 + 1);
+    d.p50 = values[k50];
+}
+
+}
+
+const char* StatisticsEngine::kernelName() {
+#if defined(__AVX2__)
+    return "AVX2";
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    return "NEON";
+#else
+    return "scalar";
+#endif
+}
+
+Distribution StatisticsEngine::describe(std::vector<std::int32_t>& values) {
+    Distribution d;
+    d.count = (long long)values.size();
+    if (values.empty()) return d;
+    Moments m = moments(values.data(), values.size());
+    d.min = m.min;
+    d.max = m.max;
+    d.mean = (double)m.sum / d.count;
+    d.variance = std::max(0.0, m.sumSquares / d.count - d.mean * d.mean);
+    percentiles(values, d);
+    return d;
+}
+
+RunStatistics StatisticsEngine::compute(const JobTable& jobs) {
+    RunStatistics stats;
+    std::size_t n = jobs.size();
+    const std::int32_t* arrival = jobs.arrivalColumn();
+    const std::int32_t* burst = jobs.burstColumn();
+    const std::int32_t* start = jobs.startColumn();
+    const std::int32_t* completion = jobs.completionColumn();
+    const std::int32_t* deadline = jobs.deadlineColumn();
+
+    // Gather the derived metrics of finished jobs into contiguous arrays
+    std::vector<std::int32_t> waiting(n), turnaround(n), response(n);
+    std::vector<std::int32_t> lateness;
+    std::size_t finished = 0;
+    long long firstArrival = std::numeric_limits<long long>::max(), lastCompletion = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (deadline[i] != kNoDeadline) {
+            ++stats.deadlineJobs;
+            if (completion[i] < 0) ++stats.deadlineUnfinished;
+            else lateness.push_back(completion[i] - deadline[i]);
+        }
+        if (completion[i] < 0) continue;
+        std::int32_t tt = completion[i] - arrival[i];
+        turnaround[finished] = tt;
+        waiting[finished] = tt - burst[i];
+        response[finished] = start[i] - arrival[i];
+        ++finished;
+        stats.totalBurst += burst[i];
+        firstArrival = std::min(firstArrival, (long long)std::max(0, arrival[i]));
+        lastCompletion = std::max(lastCompletion, (long long)completion[i]);
+    }
+    waiting.resize(finished);
+    turnaround.resize(finished);
+    response.resize(finished);
+
+    stats.jobs = (long long)turnaround.size();
+    stats.waiting = describe(waiting);
+    stats.turnaround = describe(turnaround);
+    stats.response = describe(response);
+    for (std::int32_t late : lateness) stats.deadlineMisses += late > 0;
+    stats.deadlineMisses += stats.deadlineUnfinished;
+    if (stats.deadlineJobs > 0) stats.deadlineMissRate = (double)stats.deadlineMisses / stats.deadlineJobs;
+    stats.lateness = describe(lateness);
+    if (stats.jobs > 0) {
+        stats.makespan = lastCompletion - firstArrival;
+        if (stats.makespan > 0) {
+            stats.throughput = (double)stats.jobs / stats.makespan;
+            stats.cpuUtilization = (double)stats.totalBurst / stats.makespan;
+        }
+    }
+    return stats;
+}
+
+std::string StatisticsEngine::formatSummary(const RunStatistics& stats) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2);
+    oss << std::left << std::setw(12) << "Metric" << std::right
+        << std::setw(10) << "Min" << std::setw(10) << "Max"
+        << std::setw(10) << "Mean" << std::setw(10) << "StdDev"
+        << std::setw(10) << "p50" << std::setw(10) << "p95" << std::setw(10) << "p99" << "\n";
+    auto row = [&](const char* label, const Distribution& d) {
+        oss << std::left << std::setw(12) << label << std::right
+            << std::setw(10) << d.min << std::setw(10) << d.max
+            << std::setw(10) << d.mean << std::setw(10) << std::sqrt(d.variance)
+            << std::setw(10) << d.p50 << std::setw(10) << d.p95 << std::setw(10) << d.p99 << "\n";
+    };
+    row("Waiting", stats.waiting);
+    row("Turnaround", stats.turnaround);
+    row("Response", stats.response);
+    if (stats.deadlineJobs > 0) {
+        if (stats.lateness.count > 0) row("Lateness", stats.lateness);
+        oss << "Deadline Misses: " << stats.deadlineMisses << " of " << stats.deadlineJobs
+            << " (" << stats.deadlineMissRate * 100 << "%)";
+        if (stats.deadlineUnfinished > 0) oss << ", " << stats.deadlineUnfinished << " not finished";
+        oss << "\n";
+    }
+    oss << "Makespan: " << stats.makespan << "\n";
+    oss << "Throughput: " << std::setprecision(4) << stats.throughput << " jobs/unit\n";
+    oss << "CPU Utilization: " << std::setprecision(2) << stats.cpuUtilization * 100 << "%\n";
+    return oss.str();
+}
+
+std::string StatisticsEngine::report(const JobTable& jobs, const std::string& algorithm) {
+    std::ostringstream oss;
+    oss << std::left << std::setw(10) << "Job"
+        << std::setw(10) << "WT"
+        << std::setw(10) << "TT" << "\n";
+    for (JobHandle h = 0; h < jobs.size(); ++h) {
+        if (!jobs.finished(h)) continue;
+        oss << std::setw(10) << jobs.name(h)
+            << std::setw(10) << jobs.waiting(h)
+            << std::setw(10) << jobs.turnaround(h) << "\n";
+    }
+    RunStatistics stats = compute(jobs);
+    if (stats.jobs > 0) {
+        oss << "Avg WT: " << stats.waiting.mean << "\n";
+        oss << "Avg TT: " << stats.turnaround.mean << "\n";
+        oss << formatSummary(stats);
+    }
+    oss << "Total Jobs: " << stats.jobs << "\n";
+    oss << "Total Burst Time: " << stats.totalBurst << "\n";
+    oss << "Algorithm: " << algorithm << "\n";
+    oss << "Compare with other algorithms in Statistics menu.\n";
+    return oss.str();
+}
\ No newline at end of file
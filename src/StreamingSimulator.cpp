@@ -0,0 +1,185 @@
+#include "../include/StreamingSimulator.h"
+#include <algorithm>
+
+JobStream::JobStream(std::size_t capacity) : ring(std::max<std::size_t>(1, capacity)) {}
+
+void JobStream::put(const StreamJob& job) {
+    ring[(head + count) % ring.size()] = job;
+    ++count;
+}
+
+bool JobStream::push(const StreamJob& job) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!closed && count == ring.size()) {
+        ++blocked;
+        notFull.wait(lock, [this] { return closed || count < ring.size(); });
+    }
+    if (closed) return false;
+    put(job);
+    lock.unlock();
+    notEmpty.notify_one();
+    return true;
+}
+
+bool JobStream::tryPush(const StreamJob& job) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (closed || count == ring.size()) return false;
+        put(job);
+    }
+    notEmpty.notify_one();
+    return true;
+}
+
+void JobStream::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+    }
+    notEmpty.notify_all();
+    notFull.notify_all();
+}
+
+std::size_t JobStream::popBatch(std::vector<StreamJob>& into, std::size_t max) {
+    std::unique_lock<std::mutex> lock(mutex);
+    notEmpty.wait(lock, [this] { return closed || count > 0; });
+    std::size_t n = std::min(count, std::max<std::size_t>(1, max));
+    for (std::size_t i = 0; i < n; ++i) {
+        into.push_back(ring[head]);
+        head = (head + 1) % ring.size();
+    }
+    count -= n;
+    lock.unlock();
+    if (n) notFull.notify_all();
+    return n;
+}
+
+std::size_t JobStream::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return count;
+}
+
+long long JobStream::blockedPushes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return blocked;
+}
+
+// Admits streamed jobs into retired rows first, so the table only grows
+// when more jobs are in flight than ever before
+class StreamingSimulator::Source : public ArrivalSource {
+public:
+    explicit Source(StreamingSimulator& owner) : owner(owner) {}
+
+    bool hasNext() override { return fill(); }
+    int peekArrivalTime() override {
+        fill();
+        return batch[cursor].arrival;
+    }
+    Job next() override {
+        const StreamJob& job = batch[cursor++];
+        return Job(job.id, job.arrival, job.burst, job.priority, job.deadline);
+    }
+    JobHandle admit(JobTable& into) override {
+        const StreamJob& job = batch[cursor++];
+        std::vector<JobHandle>& free = owner.freeHandles;
+        JobHandle h;
+        if (free.empty()) {
+            h = into.add(job.id, {}, job.arrival, job.burst, job.priority, job.deadline);
+        } else {
+            h = free.back();
+            free.pop_back();
+            into.reuse(h, job.id, job.arrival, job.burst, job.priority, job.deadline);
+        }
+        ++owner.total.admitted;
+        owner.total.peakInFlight = std::max(owner.total.peakInFlight, into.size() - free.size());
+        return h;
+    }
+
+private:
+    StreamingSimulator& owner;
+    std::vector<StreamJob> batch;
+    std::size_t cursor = 0;
+
+    bool fill() {
+        if (cursor < batch.size()) return true;
+        batch.clear();
+        cursor = 0;
+        return owner.input.popBatch(batch, owner.options.batch) > 0;
+    }
+};
+
+StreamingSimulator::StreamingSimulator(std::unique_ptr<Scheduler> scheduler, JobStream& input,
+                                       StreamOptions options, std::pmr::memory_resource* memory)
+    : input(input), options(std::move(options)) {
+    this->options.window = std::max(1, this->options.window);
+    sim = std::make_unique<Simulator>(std::move(scheduler), std::make_unique<Source>(*this), memory);
+    sim->setEventLogging(false);
+    sim->setGanttRecording(false);
+    sim->setRetirement(this);
+}
+
+void StreamingSimulator::run() {
+    while (step()) {}
+}
+
+bool StreamingSimulator::step() {
+    if (finished) return false;
+    if (sim->step()) return true;
+    finished = true;
+    if (windowCompleted > 0 || windowRejected > 0) emit(std::max(sim->getCurrentTime(), (int)(windowIndex * options.window) + 1));
+    return false;
+}
+
+void StreamingSimulator::retire(const JobTable& jobs, JobHandle job, int time) {
+    long long w = options.window;
+    long long index = time >= 0 ? time / w : -((-(long long)time + w - 1) / w);
+    if (index != windowIndex) {
+        if (windowCompleted > 0 || windowRejected > 0) emit((int)((windowIndex + 1) * w));
+        windowIndex = index;
+    }
+    if (jobs.finished(job)) {
+        ++windowCompleted;
+        ++total.completed;
+        waiting.push_back(jobs.waiting(job));
+        turnaround.push_back(jobs.turnaround(job));
+        response.push_back(jobs.start(job) - jobs.arrival(job));
+        total.waiting.add(jobs.waiting(job));
+        total.turnaround.add(jobs.turnaround(job));
+        total.response.add(jobs.start(job) - jobs.arrival(job));
+    } else {
+        ++windowRejected;
+        ++total.rejected;
+    }
+    if (jobs.hasDeadline(job)) {
+        ++windowDeadlineJobs;
+        if (!jobs.finished(job) || jobs.lateness(job) > 0) {
+            ++windowMisses;
+            ++total.deadlineMisses;
+        }
+    }
+    freeHandles.push_back(job);
+}
+
+void StreamingSimulator::emit(int end) {
+    StreamWindow window;
+    window.index = windowIndex;
+    window.start = (int)(windowIndex * options.window);
+    window.end = end;
+    window.completed = windowCompleted;
+    window.rejected = windowRejected;
+    window.throughput = (double)windowCompleted / std::max(1, end - window.start);
+    window.waiting = StatisticsEngine::describe(waiting);
+    window.turnaround = StatisticsEngine::describe(turnaround);
+    window.response = StatisticsEngine::describe(response);
+    window.deadlineJobs = windowDeadlineJobs;
+    window.deadlineMisses = windowMisses;
+    window.inFlight = inFlight();
+    window.backlog = input.size();
+    // Keeps the sample buffers' capacity for the next window
+    waiting.clear();
+    turnaround.clear();
+    response.clear();
+    windowCompleted = windowRejected = windowDeadlineJobs = windowMisses = 0;
+    ++total.windows;
+    if (options.onWindow) options.onWindow(window);
+}
\ No newline at end of file
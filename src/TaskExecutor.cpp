@@ -0,0 +1,166 @@
+#include "../include/TaskExecutor.h"
+#include <algorithm>
+#include <exception>
+
+void TaskContext::progress(double fraction, const std::string& note) {
+    std::lock_guard<std::mutex> lock(owner.mutex);
+    auto it = owner.tasks.find(id);
+    if (it == owner.tasks.end()) return;
+    it->second->progress = fraction;
+    if (!note.empty()) it->second->note = note;
+}
+
+void TaskContext::partial(std::string text) {
+    std::lock_guard<std::mutex> lock(owner.mutex);
+    auto it = owner.tasks.find(id);
+    if (it != owner.tasks.end()) it->second->partial = std::move(text);
+}
+
+TaskExecutor::TaskExecutor(unsigned workers) : pool(std::max(1u, workers)) {}
+
+TaskExecutor::~TaskExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto& entry : tasks) entry.second->cancel = true;
+    }
+    // The pool's destructor drains the queue: cancelled tasks return at once
+}
+
+long long TaskExecutor::submit(std::string label, Body body) {
+    auto task = std::make_shared<Task>();
+    task->label = std::move(label);
+    task->body = std::move(body);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        task->id = nextId++;
+        tasks.emplace(task->id, task);
+        ++queued;
+    }
+    pool.submit([this, task] { run(task); });
+    return task->id;
+}
+
+void TaskExecutor::run(const std::shared_ptr<Task>& task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        --queued;
+        if (task->cancel) {
+            task->state = TaskState::Cancelled;
+            task->started = task->ended = std::chrono::steady_clock::now();
+            if (queued == 0 && running == 0) idle.notify_all();
+            return;
+        }
+        task->state = TaskState::Running;
+        task->started = std::chrono::steady_clock::now();
+        ++running;
+    }
+    TaskContext context(*this, task->id, task->cancel);
+    TaskOutcome outcome;
+    TaskState state = TaskState::Finished;
+    try {
+        outcome = task->body(context);
+        if (task->cancel) state = TaskState::Cancelled;
+    } catch (const std::exception& e) {
+        state = TaskState::Failed;
+        outcome.report = e.what();
+    } catch (...) {
+        state = TaskState::Failed;
+        outcome.report = "unknown error";
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    task->state = state;
+    task->ended = std::chrono::steady_clock::now();
+    task->report = std::move(outcome.report);
+    if (state == TaskState::Finished) {
+        task->progress = 1;
+        task->note.clear();
+        if (outcome.apply) applies.push_back(std::move(outcome.apply));
+    }
+    task->body = nullptr;
+    --running;
+    if (queued == 0 && running == 0) idle.notify_all();
+}
+
+bool TaskExecutor::cancel(long long id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = tasks.find(id);
+    if (it == tasks.end()) return false;
+    Task& task = *it->second;
+    if (task.state != TaskState::Queued && task.state != TaskState::Running) return false;
+    task.cancel = true;
+    if (task.state == TaskState::Queued) task.note = "cancelled before it started";
+    return true;
+}
+
+TaskStatus TaskExecutor::snapshot(const Task& task) const {
+    TaskStatus status;
+    status.id = task.id;
+    status.label = task.label;
+    status.state = task.state;
+    status.progress = task.progress;
+    status.note = task.note;
+    status.partial = task.partial;
+    status.report = task.report;
+    if (task.state != TaskState::Queued) {
+        auto end = task.state == TaskState::Running ? std::chrono::steady_clock::now() : task.ended;
+        status.elapsedMs = std::chrono::duration<double, std::milli>(end - task.started).count();
+    }
+    return status;
+}
+
+std::vector<TaskStatus> TaskExecutor::poll() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<TaskStatus> statuses;
+    statuses.reserve(tasks.size());
+    for (const auto& entry : tasks) statuses.push_back(snapshot(*entry.second));
+    return statuses;
+}
+
+bool TaskExecutor::status(long long id, TaskStatus& into) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = tasks.find(id);
+    if (it == tasks.end()) return false;
+    into = snapshot(*it->second);
+    return true;
+}
+
+std::size_t TaskExecutor::active() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return queued + running;
+}
+
+std::size_t TaskExecutor::collect() {
+    std::vector<std::function<void()>> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ready.swap(applies);
+    }
+    // Outside the lock: an apply step may submit more tasks
+    for (auto& apply : ready) apply();
+    return ready.size();
+}
+
+void TaskExecutor::clearFinished() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = tasks.begin(); it != tasks.end();) {
+        TaskState state = it->second->state;
+        if (state == TaskState::Queued || state == TaskState::Running) ++it;
+        else it = tasks.erase(it);
+    }
+}
+
+void TaskExecutor::wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this] { return queued == 0 && running == 0; });
+}
+
+const char* TaskExecutor::stateName(TaskState state) {
+    switch (state) {
+    case TaskState::Queued: return "queued";
+    case TaskState::Running: return "running";
+    case TaskState::Finished: return "finished";
+    case TaskState::Cancelled: return "cancelled";
+    case TaskState::Failed: return "failed";
+    }
+    return "";
+}
\ No newline at end of file
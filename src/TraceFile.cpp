@@ -0,0 +1,333 @@
+#include "../include/TraceFile.h"
+#include <cstdio>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define TRACE_FILE_MMAP 1
+#endif
+
+namespace {
+
+const char kMagic[8] = { 'J', 'S', 'T', 'R', 'A', 'C', 'E', '\0' };
+constexpr std::uint32_t kEndianTag = 0x01020304u;
+
+std::uint64_t align8(std::uint64_t n) { return (n + 7) & ~std::uint64_t(7); }
+
+// Writes columns back to back, padding each to the next 8-byte boundary,
+// to a file or to memory
+class ColumnWriter {
+public:
+    explicit ColumnWriter(std::FILE* file) : file(file) {}
+    explicit ColumnWriter(std::string& bytes) : bytes(&bytes) {}
+    void write(const void* data, std::size_t size) {
+        put(data, size);
+        static const char zeros[8] = {};
+        put(zeros, (std::size_t)(align8(size) - size));
+    }
+    bool failed = false;
+
+private:
+    std::FILE* file = nullptr;
+    std::string* bytes = nullptr;
+
+    void put(const void* data, std::size_t size) {
+        if (!size) return;
+        if (bytes) bytes->append((const char*)data, size);
+        else if (std::fwrite(data, 1, size, file) != size) failed = true;
+    }
+};
+
+void writeColumns(ColumnWriter& out, TraceKind kind, const JobTable& jobs, const GanttChart* gantt) {
+    std::size_t n = jobs.size();
+    const std::pmr::vector<char>& names = jobs.namePoolData();
+
+    TraceHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof kMagic);
+    header.version = TraceFile::kVersion;
+    header.kind = (std::uint32_t)kind;
+    header.endianTag = kEndianTag;
+    header.jobCount = n;
+    header.segmentCount = gantt ? gantt->size() : 0;
+    header.nameBytes = names.size();
+    header.fileSize = MappedTrace::layoutFor(header).end;
+
+    out.write(&header, sizeof header);
+    out.write(jobs.idColumn(), n * 4);
+    out.write(jobs.arrivalColumn(), n * 4);
+    out.write(jobs.burstColumn(), n * 4);
+    out.write(jobs.priorityColumn(), n * 4);
+    out.write(jobs.deadlineColumn(), n * 4);
+    if (kind == TraceKind::Schedule) {
+        out.write(jobs.remainingColumn(), n * 4);
+        out.write(jobs.startColumn(), n * 4);
+        out.write(jobs.completionColumn(), n * 4);
+    }
+    const std::pmr::vector<std::size_t>& offsets = jobs.nameOffsetColumn();
+    if (sizeof(std::size_t) == sizeof(std::uint64_t)) {
+        out.write(offsets.data(), offsets.size() * 8);
+    } else {
+        std::vector<std::uint64_t> wide(offsets.begin(), offsets.end());
+        out.write(wide.data(), wide.size() * 8);
+    }
+    out.write(names.data(), names.size());
+    if (kind == TraceKind::Schedule) {
+        const std::pmr::vector<GanttSegment>& segments = gantt->segments();
+        std::size_t m = segments.size();
+        std::vector<std::int32_t> column(m);
+        for (std::size_t i = 0; i < m; ++i) column[i] = (std::int32_t)segments[i].job;
+        out.write(column.data(), m * 4);
+        for (std::size_t i = 0; i < m; ++i) column[i] = segments[i].start;
+        out.write(column.data(), m * 4);
+        for (std::size_t i = 0; i < m; ++i) column[i] = segments[i].length;
+        out.write(column.data(), m * 4);
+    }
+}
+
+bool writeTrace(const std::string& path, TraceKind kind, const JobTable& jobs, const GanttChart* gantt,
+                std::string& error) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) { error = "cannot open " + path + " for writing"; return false; }
+    ColumnWriter out(file);
+    writeColumns(out, kind, jobs, gantt);
+    bool ok = !out.failed && std::fclose(file) == 0;
+    if (!ok) error = "write to " + path + " failed";
+    return ok;
+}
+
+}
+
+MappedTrace::Layout MappedTrace::layoutFor(const TraceHeader& header) {
+    Layout layout;
+    std::uint64_t offset = sizeof(TraceHeader);
+    auto take = [&offset](std::uint64_t bytes) {
+        std::uint64_t at = offset;
+        offset += align8(bytes);
+        return at;
+    };
+    std::uint64_t n = header.jobCount;
+    bool schedule = header.kind == (std::uint32_t)TraceKind::Schedule;
+    layout.ids = take(n * 4);
+    layout.arrivals = take(n * 4);
+    layout.bursts = take(n * 4);
+    layout.priorities = take(n * 4);
+    if (header.version >= 2) layout.deadlines = take(n * 4);
+    if (schedule) {
+        layout.remainings = take(n * 4);
+        layout.starts = take(n * 4);
+        layout.completions = take(n * 4);
+    }
+    layout.nameOffsets = take((n + 1) * 8);
+    layout.names = take(header.nameBytes);
+    if (schedule) {
+        layout.segmentJobs = take(header.segmentCount * 4);
+        layout.segmentStarts = take(header.segmentCount * 4);
+        layout.segmentLengths = take(header.segmentCount * 4);
+    }
+    layout.end = offset;
+    return layout;
+}
+
+MappedTrace::~MappedTrace() {
+    close();
+}
+
+void MappedTrace::close() {
+#ifdef TRACE_FILE_MMAP
+    if (mapped) ::munmap((void*)data, size);
+#endif
+    mapped = false;
+    data = nullptr;
+    size = 0;
+    buffer.clear();
+}
+
+bool MappedTrace::open(const std::string& path, std::string& error) {
+    close();
+#ifdef TRACE_FILE_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd >= 0 && ::fstat(fd, &st) == 0 && st.st_size > 0) {
+        void* map = ::mmap(nullptr, (std::size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+            data = (const char*)map;
+            size = (std::size_t)st.st_size;
+            mapped = true;
+        }
+    }
+    if (fd >= 0) ::close(fd);
+#endif
+    if (!mapped) {
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        if (!file) { error = "cannot open " + path; return false; }
+        std::vector<char> bytes;
+        char block[1 << 16];
+        std::size_t got;
+        while ((got = std::fread(block, 1, sizeof block, file)) > 0) bytes.insert(bytes.end(), block, block + got);
+        std::fclose(file);
+        copy(bytes.data(), bytes.size());
+    }
+    return validate(path, error);
+}
+
+bool MappedTrace::load(std::string_view bytes, const std::string& label, std::string& error) {
+    close();
+    copy(bytes.data(), bytes.size());
+    return validate(label, error);
+}
+
+void MappedTrace::copy(const char* bytes, std::size_t count) {
+    // Kept in 8-byte words so the columns stay aligned
+    buffer.assign((count + 7) / 8, 0);
+    if (count) std::memcpy(buffer.data(), bytes, count);
+    data = (const char*)buffer.data();
+    size = count;
+}
+
+bool MappedTrace::validate(const std::string& path, std::string& error) {
+    auto fail = [&](const std::string& why) {
+        error = path + ": " + why;
+        close();
+        return false;
+    };
+    if (size < sizeof(TraceHeader)) return fail("not a trace file");
+    std::memcpy(&header, data, sizeof header);
+    if (std::memcmp(header.magic, kMagic, sizeof kMagic) != 0) return fail("not a trace file");
+    if (header.endianTag != kEndianTag) return fail("trace was written with a different byte order");
+    if (header.version < 1 || header.version > TraceFile::kVersion)
+        return fail("unsupported trace version " + std::to_string(header.version));
+    if (header.kind != (std::uint32_t)TraceKind::Jobs && header.kind != (std::uint32_t)TraceKind::Schedule)
+        return fail("unknown trace kind");
+    // Bound the counts before they feed the layout arithmetic
+    if (header.jobCount > size || header.segmentCount > size || header.nameBytes > size ||
+        header.fileSize != size)
+        return fail("truncated or corrupt trace");
+    offsets = layoutFor(header);
+    if (offsets.end != size) return fail("truncated or corrupt trace");
+
+    // Names and segments are indexed through these later, so check them once
+    std::size_t n = jobCount();
+    const std::uint64_t* nameOffset = nameOffsets();
+    if (nameOffset[0] != 0 || nameOffset[n] != header.nameBytes) return fail("corrupt name table");
+    for (std::size_t i = 0; i < n; ++i)
+        if (nameOffset[i] > nameOffset[i + 1]) return fail("corrupt name table");
+    if (kind() == TraceKind::Schedule) {
+        const std::uint32_t* job = segmentJobs();
+        for (std::size_t i = 0; i < segmentCount(); ++i)
+            if (job[i] >= n) return fail("Gantt segment refers to a missing job");
+    }
+    return true;
+}
+
+void MappedTrace::appendTo(JobTable& jobs, bool withResults) const {
+    bool results = withResults && kind() == TraceKind::Schedule;
+    jobs.appendColumns(jobCount(), ids(), arrivals(), bursts(), priorities(), deadlines(),
+                       results ? remainings() : nullptr,
+                       results ? starts() : nullptr,
+                       results ? completions() : nullptr,
+                       names(), nameOffsets());
+}
+
+void MappedTrace::appendTo(GanttChart& gantt, JobHandle firstJob) const {
+    const std::uint32_t* job = segmentJobs();
+    const std::int32_t* start = segmentStarts();
+    const std::int32_t* length = segmentLengths();
+    gantt.reserve(gantt.size() + segmentCount());
+    for (std::size_t i = 0; i < segmentCount(); ++i)
+        gantt.record(firstJob + job[i], start[i], length[i]);
+}
+
+bool TraceFile::writeJobs(const std::string& path, const JobTable& jobs, std::string& error) {
+    return writeTrace(path, TraceKind::Jobs, jobs, nullptr, error);
+}
+
+bool TraceFile::writeSchedule(const std::string& path, const JobTable& jobs, const GanttChart& gantt,
+                              std::string& error) {
+    return writeTrace(path, TraceKind::Schedule, jobs, &gantt, error);
+}
+
+void TraceFile::encodeJobs(const JobTable& jobs, std::string& bytes) {
+    bytes.clear();
+    ColumnWriter out(bytes);
+    writeColumns(out, TraceKind::Jobs, jobs, nullptr);
+}
+
+bool TraceFile::decodeJobs(std::string_view bytes, const std::string& label, JobTable& jobs, std::string& error) {
+    MappedTrace trace;
+    if (!trace.load(bytes, label, error)) return false;
+    trace.appendTo(jobs, false);
+    return true;
+}
+
+bool TraceFile::readJobs(const std::string& path, JobTable& jobs, std::string& error) {
+    MappedTrace trace;
+    if (!trace.open(path, error)) return false;
+    trace.appendTo(jobs, false);
+    return true;
+}
+
+bool TraceFile::readSchedule(const std::string& path, JobTable& jobs, GanttChart& gantt, std::string& error) {
+    MappedTrace trace;
+    if (!trace.open(path, error)) return false;
+    if (trace.kind() != TraceKind::Schedule) {
+        error = path + ": holds a job set, not a schedule";
+        return false;
+    }
+    JobHandle first = (JobHandle)jobs.size();
+    trace.appendTo(jobs, true);
+    trace.appendTo(gantt, first);
+    return true;
+}
+
+bool TraceFile::csvToTrace(const std::string& csvPath, const std::string& tracePath, std::string& error,
+                           CsvLoadResult* rows) {
+    JobTable jobs;
+    CsvLoadResult result = CsvJobLoader::load(csvPath, jobs);
+    if (rows) *rows = result;
+    if (!result.opened) { error = "cannot open " + csvPath; return false; }
+    return writeJobs(tracePath, jobs, error);
+}
+
+bool TraceFile::traceToCsv(const std::string& tracePath, const std::string& csvPath, std::string& error) {
+    JobTable jobs;
+    if (!readJobs(tracePath, jobs, error)) return false;
+    return writeCsv(csvPath, jobs, error);
+}
+
+bool TraceFile::writeCsv(const std::string& path, const JobTable& jobs, std::string& error) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) { error = "cannot open " + path + " for writing"; return false; }
+    bool named = !jobs.namePoolData().empty();
+    bool withDeadlines = false;
+    for (JobHandle h = 0; h < jobs.size() && !withDeadlines; ++h) withDeadlines = jobs.hasDeadline(h);
+    std::string out = named ? "name,arrival,burst,priority" : "id,arrival,burst,priority";
+    out += withDeadlines ? ",deadline\n" : "\n";
+    bool ok = true;
+    for (JobHandle h = 0; h < jobs.size(); ++h) {
+        std::string_view name = jobs.name(h);
+        if (name.empty()) out += std::to_string(jobs.id(h));
+        else out.append(name.data(), name.size());
+        out += ',';
+        out += std::to_string(jobs.arrival(h));
+        out += ',';
+        out += std::to_string(jobs.burst(h));
+        out += ',';
+        out += std::to_string(jobs.priority(h));
+        if (withDeadlines) {
+            out += ',';
+            if (jobs.hasDeadline(h)) out += std::to_string(jobs.deadline(h));
+        }
+        out += '\n';
+        if (out.size() >= (1 << 20)) {
+            ok = ok && std::fwrite(out.data(), 1, out.size(), file) == out.size();
+            out.clear();
+        }
+    }
+    ok = ok && std::fwrite(out.data(), 1, out.size(), file) == out.size();
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok) error = "write to " + path + " failed";
+    return ok;
+}
\ No newline at end of file
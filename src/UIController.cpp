@@ -4,23 +4,36 @@
 void UIController::loadSchedulerPlugin(const std::string& path) {
     pluginPath = path;
     scheduler = SchedulerFactory::loadPlugin(path);
+    runs.reset();
 }
 // UIController.cpp
 #include "../include/UIController.h"
+#include "../include/CsvLoader.h"
+#include "../include/TraceFile.h"
+#include "../include/ComparisonRunner.h"
+#include "../include/ParameterSweep.h"
+#include "../include/MultiCoreSimulator.h"
+#include "../include/GanttRenderer.h"
 #include <iostream>
 #include <fstream>
 #include <iomanip>
 #include <limits>
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
 
-UIController::UIController() : currentAlgorithm(0) {
+UIController::UIController() : currentAlgorithm(0), runs([this] { return makeScheduler(); }), tasks(2) {
     switchAlgorithm(0);
 }
 
 void UIController::runSession() {
     while (true) {
+        // Results of tasks that finished while the last menu was up
+        tasks.collect();
         clearScreen();
         showMainMenu();
-        int choice = getIntInput("Select an option: ", 1, 6);
+        int choice = getIntInput("Select an option: ", 1, 7);
         handleMainMenuInput(choice);
     }
 }
@@ -32,7 +45,11 @@ void UIController::showMainMenu() {
     std::cout << "3. Visualization\n";
     std::cout << "4. Statistics\n";
     std::cout << "5. Help\n";
-    std::cout << "6. Exit\n";
+    std::cout << "6. Background Tasks\n";
+    std::cout << "7. Exit\n";
+    std::size_t running = tasks.active();
+    std::size_t total = tasks.poll().size();
+    if (total > 0) std::cout << "(" << running << " background task(s) active, " << total - running << " done)\n";
 }
 
 void UIController::handleMainMenuInput(int choice) {
@@ -42,7 +59,8 @@ void UIController::handleMainMenuInput(int choice) {
         case 3: showVisualizationMenu(); break;
         case 4: showStatisticsMenu(); break;
         case 5: showHelpOverlay(); pause(); break;
-        case 6: exit(0);
+        case 6: showTaskMenu(); break;
+        case 7: exit(0);
         default: error("Invalid choice."); pause();
     }
 }
@@ -55,8 +73,10 @@ void UIController::showJobMenu() {
     std::cout << "3. Delete Job\n";
     std::cout << "4. Import Jobs from CSV\n";
     std::cout << "5. Export Jobs to CSV\n";
-    std::cout << "6. Back\n";
-    int choice = getIntInput("Select an option: ", 1, 6);
+    std::cout << "6. Import Jobs from Binary Trace\n";
+    std::cout << "7. Export Jobs to Binary Trace\n";
+    std::cout << "8. Back\n";
+    int choice = getIntInput("Select an option: ", 1, 8);
     handleJobMenuInput(choice);
 }
 
@@ -67,7 +87,9 @@ void UIController::handleJobMenuInput(int choice) {
         case 3: deleteJob(); break;
         case 4: importJobsCSV(); break;
         case 5: exportJobsCSV(); break;
-        case 6: return;
+        case 6: importJobsTrace(); break;
+        case 7: exportJobsTrace(); break;
+        case 8: return;
         default: error("Invalid choice."); pause();
     }
 }
@@ -79,13 +101,17 @@ void UIController::showAlgorithmMenu() {
     std::cout << "2. SJF\n";
     std::cout << "3. Round Robin\n";
     std::cout << "4. Priority\n";
-    std::cout << "5. Back\n";
-    int choice = getIntInput("Select an algorithm: ", 1, 5);
+    std::cout << "5. MLFQ\n";
+    std::cout << "6. CFS (Completely Fair)\n";
+    std::cout << "7. EDF (Earliest Deadline First)\n";
+    std::cout << "8. LLF (Least Laxity First)\n";
+    std::cout << "9. Back\n";
+    int choice = getIntInput("Select an algorithm: ", 1, 9);
     handleAlgorithmMenuInput(choice);
 }
 
 void UIController::handleAlgorithmMenuInput(int choice) {
-    if (choice >= 1 && choice <= 4) {
+    if (choice >= 1 && choice <= 8) {
         switchAlgorithm(choice - 1);
         updateScheduler();
         std::cout << "Algorithm switched.\n";
@@ -98,8 +124,10 @@ void UIController::showVisualizationMenu() {
     std::cout << "=== Visualization ===\n";
     std::cout << "1. Display Gantt Chart\n";
     std::cout << "2. Display Timeline Log\n";
-    std::cout << "3. Back\n";
-    int choice = getIntInput("Select an option: ", 1, 3);
+    std::cout << "3. Zoom Gantt Chart to a Time Range\n";
+    std::cout << "4. Export Gantt Chart (Chrome trace / SVG)\n";
+    std::cout << "5. Back\n";
+    int choice = getIntInput("Select an option: ", 1, 5);
     handleVisualizationMenuInput(choice);
 }
 
@@ -107,7 +135,9 @@ void UIController::handleVisualizationMenuInput(int choice) {
     switch (choice) {
         case 1: displayGanttChart(); pause(); break;
         case 2: displayTimelineLog(); pause(); break;
-        case 3: return;
+        case 3: zoomGanttChart(); pause(); break;
+        case 4: exportGanttChart(); pause(); break;
+        case 5: return;
         default: error("Invalid choice."); pause();
     }
 }
@@ -115,11 +145,27 @@ void UIController::handleVisualizationMenuInput(int choice) {
 void UIController::showStatisticsMenu() {
     clearScreen();
     std::cout << "=== Statistics ===\n";
-    displayStatistics();
-    pause();
+    std::cout << "1. Current Algorithm\n";
+    std::cout << "2. Compare All Algorithms\n";
+    std::cout << "3. Parameter Sweep (RR quantum / aging)\n";
+    std::cout << "4. Multi-Core Simulation\n";
+    std::cout << "5. Instrumentation (phase timings and counters)\n";
+    std::cout << "6. Back\n";
+    int choice = getIntInput("Select an option: ", 1, 6);
+    handleStatisticsMenuInput(choice);
 }
 
-void UIController::handleStatisticsMenuInput(int) {}
+void UIController::handleStatisticsMenuInput(int choice) {
+    switch (choice) {
+        case 1: displayStatistics(); pause(); break;
+        case 2: displayComparison(); pause(); break;
+        case 3: runParameterSweep(); pause(); break;
+        case 4: displayMultiCore(); pause(); break;
+        case 5: displayInstrumentation(); pause(); break;
+        case 6: return;
+        default: error("Invalid choice."); pause();
+    }
+}
 
 void UIController::showHelpOverlay() {
     std::cout << "Help:\n";
@@ -128,16 +174,52 @@ void UIController::showHelpOverlay() {
     std::cout << "- Statistics display per-job and aggregate info.\n";
     std::cout << "- You can switch algorithms anytime.\n";
     std::cout << "- Use CSV import/export for batch job management.\n";
+    std::cout << "- Background Tasks run simulations, comparisons, sweeps and imports\n";
+    std::cout << "  without blocking the menus; check on them, view or cancel them there.\n";
     std::cout << "- Robust error handling is provided throughout.\n";
 }
 
+void UIController::showTaskMenu() {
+    tasks.collect();
+    clearScreen();
+    std::cout << "=== Background Tasks ===\n";
+    listTasks();
+    std::cout << "1. Refresh\n";
+    std::cout << "2. View Task Result\n";
+    std::cout << "3. Cancel Task\n";
+    std::cout << "4. Simulate Current Algorithm\n";
+    std::cout << "5. Compare All Algorithms\n";
+    std::cout << "6. Parameter Sweep\n";
+    std::cout << "7. Import Jobs from CSV\n";
+    std::cout << "8. Clear Finished Tasks\n";
+    std::cout << "9. Back\n";
+    int choice = getIntInput("Select an option: ", 1, 9);
+    handleTaskMenuInput(choice);
+}
+
+void UIController::handleTaskMenuInput(int choice) {
+    switch (choice) {
+        case 1: showTaskMenu(); break;
+        case 2: viewTask(); pause(); showTaskMenu(); break;
+        case 3: cancelTask(); pause(); showTaskMenu(); break;
+        case 4: startSimulationTask(); pause(); showTaskMenu(); break;
+        case 5: startComparisonTask(); pause(); showTaskMenu(); break;
+        case 6: startSweepTask(); pause(); showTaskMenu(); break;
+        case 7: startImportTask(); pause(); showTaskMenu(); break;
+        case 8: tasks.clearFinished(); showTaskMenu(); break;
+        case 9: return;
+        default: error("Invalid choice."); pause();
+    }
+}
+
 void UIController::createJob() {
     std::cout << "Enter Job Name: ";
     std::string name = getStringInput("");
     int arrival = getIntInput("Arrival Time: ", 0, 10000);
     int burst = getIntInput("Burst Time: ", 1, 10000);
     int priority = getIntInput("Priority: ", 0, 100);
-    jobs.push_back(Job(name, arrival, burst, priority));
+    int deadline = getIntInput("Deadline (0 for none): ", 0, 1000000);
+    jobs.push_back(Job(name, arrival, burst, priority, deadline > 0 ? deadline : kNoDeadline));
     updateScheduler();
     std::cout << "Job created.\n";
     pause();
@@ -153,6 +235,8 @@ void UIController::editJob() {
     jobs[idx].setArrivalTime(getIntInput("New Arrival Time: ", 0, 10000));
     jobs[idx].setBurstTime(getIntInput("New Burst Time: ", 1, 10000));
     jobs[idx].setPriority(getIntInput("New Priority: ", 0, 100));
+    int deadline = getIntInput("New Deadline (0 for none): ", 0, 1000000);
+    jobs[idx].setDeadline(deadline > 0 ? deadline : kNoDeadline);
     updateScheduler();
     std::cout << "Job updated.\n";
     pause();
@@ -172,20 +256,16 @@ void UIController::deleteJob() {
 
 void UIController::importJobsCSV() {
     std::string filename = getStringInput("CSV filename to import: ");
-    std::ifstream file(filename);
-    if (!file) { error("File not found."); pause(); return; }
-    jobs.clear();
-    std::string line;
-    while (std::getline(file, line)) {
-        std::istringstream ss(line);
-        std::string name;
-        int arrival, burst, priority;
-        char delim;
-        if (ss >> name >> delim >> arrival >> delim >> burst >> delim >> priority)
-            jobs.push_back(Job(name, arrival, burst, priority));
-    }
+    std::vector<Job> imported;
+    CsvLoadResult result = CsvJobLoader::load(filename, imported);
+    if (!result.opened) { error("File not found."); pause(); return; }
+    for (const auto& rowError : result.errors)
+        error("Line " + std::to_string(rowError.line) + ": " + rowError.message);
+    if (result.errorCount > result.errors.size())
+        error(std::to_string(result.errorCount - result.errors.size()) + " more rows skipped.");
+    jobs = std::move(imported);
     updateScheduler();
-    std::cout << "Jobs imported.\n";
+    std::cout << "Jobs imported: " << result.rows << "\n";
     pause();
 }
 
@@ -193,44 +273,403 @@ void UIController::exportJobsCSV() {
     std::string filename = getStringInput("CSV filename to export: ");
     std::ofstream file(filename);
     if (!file) { error("Cannot open file."); pause(); return; }
-    for (const auto& job : jobs)
-        file << job.getName() << "," << job.getArrivalTime() << "," << job.getBurstTime() << "," << job.getPriority() << "\n";
+    bool withDeadlines = std::any_of(jobs.begin(), jobs.end(), [](const Job& job) { return job.hasDeadline(); });
+    for (const auto& job : jobs) {
+        file << job.getName() << "," << job.getArrivalTime() << "," << job.getBurstTime() << "," << job.getPriority();
+        if (withDeadlines) file << "," << (job.hasDeadline() ? std::to_string(job.getDeadline()) : "");
+        file << "\n";
+    }
+    std::cout << "Jobs exported.\n";
+    pause();
+}
+
+void UIController::importJobsTrace() {
+    std::string filename = getStringInput("Trace filename to import: ");
+    JobTable table;
+    std::string message;
+    if (!TraceFile::readJobs(filename, table, message)) { error(message); pause(); return; }
+    jobs.clear();
+    jobs.reserve(table.size());
+    for (JobHandle h = 0; h < table.size(); ++h) jobs.push_back(table.toJob(h));
+    updateScheduler();
+    std::cout << "Jobs imported: " << jobs.size() << "\n";
+    pause();
+}
+
+void UIController::exportJobsTrace() {
+    std::string filename = getStringInput("Trace filename to export: ");
+    JobTable table;
+    table.reserve(jobs.size());
+    for (const auto& job : jobs) table.add(job);
+    std::string message;
+    if (!TraceFile::writeJobs(filename, table, message)) { error(message); pause(); return; }
     std::cout << "Jobs exported.\n";
     pause();
 }
 
 void UIController::switchAlgorithm(int algo) {
     currentAlgorithm = algo;
-    switch (algo) {
-        case 0: scheduler = std::make_unique<FCFSScheduler>(); break;
-        case 1: scheduler = std::make_unique<SJFScheduler>(); break;
-        case 2: scheduler = std::make_unique<RoundRobinScheduler>(); break;
-        case 3: scheduler = std::make_unique<PriorityScheduler>(); break;
-        default: scheduler = std::make_unique<FCFSScheduler>();
-    }
+    pluginPath.clear();
+    scheduler = makeScheduler();
+    runs.reset();
     updateScheduler();
 }
 
+std::unique_ptr<Scheduler> UIController::makeScheduler() const {
+    if (!pluginPath.empty()) return SchedulerFactory::loadPlugin(pluginPath);
+    switch (currentAlgorithm) {
+        case 0: return std::make_unique<FCFSScheduler>();
+        case 1: return std::make_unique<SJFScheduler>();
+        case 2: return std::make_unique<RoundRobinScheduler>();
+        case 3: return std::make_unique<PriorityScheduler>();
+        case 4: return std::make_unique<MLFQScheduler>();
+        case 5: return std::make_unique<CFSScheduler>();
+        case 6: return std::make_unique<EDFScheduler>();
+        case 7: return std::make_unique<LLFScheduler>();
+        default: return std::make_unique<FCFSScheduler>();
+    }
+}
+
+const Simulator* UIController::simulate() {
+    if (!scheduler) return nullptr;
+    return runs.update(jobs);
+}
+
 void UIController::updateScheduler() {
-    if (scheduler) scheduler->setJobs(jobs);
+    // Brings the result up to date now, so the views that follow are instant
+    if (scheduler && !cachedRun()) runs.update(jobs);
+}
+
+std::shared_ptr<const CachedRun> UIController::cachedRun() {
+    std::string config = scheduler ? scheduler->configKey() : std::string();
+    if (config.empty()) return nullptr;
+    auto set = SharedJobSet::create(jobs);
+    std::uint64_t hash = ResultCache::hashJobs(*set);
+    if (auto hit = results.find(*set, hash, config)) return hit;
+    const Simulator* run = simulate();
+    return results.store(hash, config, run->getJobTable(), run->getGanttChart());
+}
+
+std::string UIController::renderRun(std::string (Scheduler::*view)() const) {
+    auto cached = cachedRun();
+    if (!cached) {
+        const Simulator* run = simulate();
+        return run ? (run->getScheduler().*view)() : std::string();
+    }
+    // A fresh instance of the policy renders the kept table and chart
+    JobTable table(cached->jobs);
+    auto viewer = makeScheduler();
+    viewer->attach(table);
+    viewer->attachGantt(cached->gantt);
+    return ((*viewer).*view)();
+}
+
+UIController::Schedule UIController::currentSchedule() {
+    Schedule schedule;
+    if (!scheduler) return schedule;
+    if ((schedule.cached = cachedRun())) {
+        schedule.jobs = &schedule.cached->jobs;
+        schedule.gantt = &schedule.cached->gantt;
+    } else if (const Simulator* run = simulate()) {
+        schedule.jobs = &run->getJobTable();
+        schedule.gantt = &run->getGanttChart();
+        schedule.events = &run->getEventLog();
+    }
+    return schedule;
+}
+
+void UIController::zoomGanttChart() {
+    Schedule schedule = currentSchedule();
+    if (!schedule.gantt) { error("No scheduler selected."); return; }
+    GanttView view;
+    view.from = getIntInput("From time: ", 0, std::numeric_limits<int>::max() - 1);
+    view.to = getIntInput("To time (exclusive): ", view.from + 1, std::numeric_limits<int>::max());
+    GanttRenderer::print(*schedule.gantt, *schedule.jobs, view);
+}
+
+void UIController::exportGanttChart() {
+    Schedule schedule = currentSchedule();
+    if (!schedule.gantt) { error("No scheduler selected."); return; }
+    std::cout << "1. Chrome trace JSON (chrome://tracing, Perfetto)\n";
+    std::cout << "2. SVG\n";
+    int format = getIntInput("Format: ", 1, 2);
+    std::string filename = getStringInput("Filename to export: ");
+    std::string message;
+    bool ok = format == 1
+        ? GanttRenderer::writeChromeTrace(filename, { schedule.gantt }, *schedule.jobs, message, schedule.events)
+        : GanttRenderer::writeSvg(filename, { schedule.gantt }, *schedule.jobs, GanttView(), message);
+    if (!ok) error(message);
+    else std::cout << "Exported " << schedule.gantt->size() << " segments to " << filename << "\n";
 }
 
 void UIController::displayGanttChart() {
     if (!scheduler) { error("No scheduler selected."); return; }
-    auto chart = scheduler->getGanttChart();
-    std::cout << "Gantt Chart:\n" << chart << "\n";
+    std::cout << renderRun(&Scheduler::getGanttChart) << "\n";
 }
 
 void UIController::displayTimelineLog() {
-    if (!scheduler) { error("No scheduler selected."); return; }
-    auto log = scheduler->getTimelineLog();
-    std::cout << "Timeline Log:\n" << log << "\n";
+    auto run = simulate();
+    if (!run) { error("No scheduler selected."); return; }
+    auto log = run->getScheduler().getTimelineLog();
+    std::cout << log << "\n";
 }
 
 void UIController::displayStatistics() {
     if (!scheduler) { error("No scheduler selected."); return; }
-    auto stats = scheduler->getStatistics();
-    std::cout << stats << "\n";
+    std::cout << renderRun(&Scheduler::getStatistics) << "\n";
+}
+
+void UIController::displayInstrumentation() {
+    // Counters cover what a run simulated, so this one goes from the start
+    auto fresh = scheduler ? makeScheduler() : nullptr;
+    if (!fresh) { error("No scheduler selected."); return; }
+    auto run = std::make_unique<Simulator>(std::move(fresh),
+                                           std::make_unique<SharedArrivalSource>(SharedJobSet::create(jobs)));
+    run->run();
+    std::cout << Instrumentation::format(run->getCounters()) << "\n";
+    if (!Instrumentation::kEnabled) return;
+    std::string filename = getStringInput("JSON dump filename (- to skip): ");
+    if (filename == "-") return;
+    std::ofstream out(filename);
+    if (!out) { error("Cannot write " + filename); return; }
+    out << Instrumentation::toJson(run->getCounters()) << "\n";
+    std::cout << "Counters written to " << filename << ".\n";
+}
+
+void UIController::displayComparison() {
+    if (jobs.empty()) { error("No jobs to compare."); return; }
+    auto rows = ComparisonRunner::run(SharedJobSet::create(jobs), ComparisonRunner::defaultConfigs(), 0, &results);
+    std::cout << ComparisonRunner::formatTable(rows) << "\n";
+}
+
+bool UIController::promptSweep(SweepGrid& grid, SweepOptions& options) {
+    if (jobs.empty()) { error("No jobs to sweep."); return false; }
+    int qFrom = getIntInput("RR quantum from: ", 1, 1000);
+    grid.rrQuanta = SweepGrid::range(qFrom, getIntInput("RR quantum to: ", qFrom, 1000));
+    int tFrom = getIntInput("Aging threshold from: ", 0, 10000);
+    int tTo = getIntInput("Aging threshold to: ", tFrom, 10000);
+    grid.agingThresholds = SweepGrid::range(tFrom, tTo, getIntInput("Aging threshold step: ", 1, 10000));
+    int iFrom = getIntInput("Aging increment from: ", 0, 100);
+    grid.agingIncrements = SweepGrid::range(iFrom, getIntInput("Aging increment to: ", iFrom, 100));
+    std::cout << "Rank by: 1. Avg WT  2. p95 WT  3. p99 WT  4. Avg TT  5. p99 TT\n";
+    options.target = (SweepMetric)(getIntInput("Select a metric: ", 1, 5) - 1);
+    return true;
+}
+
+void UIController::runParameterSweep() {
+    SweepGrid grid;
+    SweepOptions options;
+    if (!promptSweep(grid, options)) return;
+    auto points = ParameterSweep::run(SharedJobSet::create(jobs), grid, options);
+    std::cout << ParameterSweep::formatRanking(points, options.target) << "\n";
+    std::string filename = getStringInput("CSV filename for the results (- to skip): ");
+    if (filename == "-") return;
+    std::string message;
+    if (ParameterSweep::writeCsv(filename, points, options.target, message))
+        std::cout << "Sweep results written to " << filename << "\n";
+    else
+        error(message);
+}
+
+void UIController::displayMultiCore() {
+    if (!makeScheduler()) { error("No scheduler selected."); return; }
+    MultiCoreConfig config;
+    config.cores = getIntInput("Number of cores: ", 1, 256);
+    std::cout << "1. Global queue  2. Per-core queues\n";
+    config.mode = getIntInput("Queueing: ", 1, 2) == 1 ? CoreQueueMode::Global : CoreQueueMode::Partitioned;
+    if (config.mode == CoreQueueMode::Partitioned)
+        config.workStealing = getIntInput("Work stealing (1 = on, 0 = off): ", 0, 1) == 1;
+    config.migrationCost = getIntInput("Migration cost: ", 0, 1000);
+    MultiCoreSimulator sim([this] { return makeScheduler(); }, jobs, config);
+    sim.run();
+    std::cout << sim.report() << "\n";
+}
+
+void UIController::listTasks() {
+    std::vector<TaskStatus> statuses = tasks.poll();
+    if (statuses.empty()) {
+        std::cout << "No background tasks.\n\n";
+        return;
+    }
+    std::cout << std::fixed << std::setprecision(1);
+    for (const auto& task : statuses) {
+        std::string label = task.label.size() > 40 ? task.label.substr(0, 37) + "..." : task.label;
+        std::cout << std::right << std::setw(4) << task.id << "  " << std::left << std::setw(42) << label
+                  << std::setw(10) << TaskExecutor::stateName(task.state) << std::right;
+        if (task.state == TaskState::Running && task.progress >= 0)
+            std::cout << std::setw(6) << task.progress * 100 << "%";
+        else
+            std::cout << std::setw(7) << "";
+        if (task.state != TaskState::Queued) std::cout << std::setw(10) << task.elapsedMs / 1000 << " s";
+        if (!task.note.empty()) std::cout << "  " << task.note;
+        std::cout << "\n";
+    }
+    std::cout << std::defaultfloat << "\n";
+}
+
+void UIController::viewTask() {
+    TaskStatus task;
+    if (!tasks.status(getIntInput("Task id: ", 1, std::numeric_limits<int>::max()), task)) {
+        error("No such task.");
+        return;
+    }
+    std::cout << task.label << ": " << TaskExecutor::stateName(task.state) << "\n";
+    switch (task.state) {
+        case TaskState::Finished: std::cout << task.report << "\n"; break;
+        case TaskState::Failed: error(task.report); break;
+        default:
+            // Partial results while it runs, and whatever a cancelled one got to
+            if (!task.partial.empty()) std::cout << "Results so far:\n" << task.partial << "\n";
+            else if (task.state == TaskState::Running) std::cout << "No results yet.\n";
+    }
+}
+
+void UIController::cancelTask() {
+    long long id = getIntInput("Task id to cancel: ", 1, std::numeric_limits<int>::max());
+    if (tasks.cancel(id)) std::cout << "Cancellation requested.\n";
+    else error("No such task, or it is already over.");
+}
+
+long long UIController::submitSimulation() {
+    static const char* const names[] = { "FCFS", "SJF", "Round Robin", "Priority", "MLFQ", "CFS", "EDF", "LLF" };
+    std::string label = pluginPath.empty() ? names[currentAlgorithm] : "Plugin " + pluginPath;
+    label += " over " + std::to_string(jobs.size()) + " jobs";
+    // Built here: a plugin scheduler is loaded on this thread
+    auto fresh = std::make_shared<std::unique_ptr<Scheduler>>(makeScheduler());
+    auto set = SharedJobSet::create(jobs);
+    ResultCache* cache = &results;
+    return tasks.submit(label, [fresh, set, cache](TaskContext& context) {
+        std::string config = (*fresh)->configKey();
+        TaskOutcome outcome;
+        std::uint64_t hash = config.empty() ? 0 : ResultCache::hashJobs(*set);
+        if (!config.empty() && cache->find(*set, hash, config)) {
+            outcome.report = "Already in the result cache; the Statistics views show it.";
+            return outcome;
+        }
+        Simulator sim(std::move(*fresh), std::make_unique<SharedArrivalSource>(set));
+        long long dispatches = 0;
+        while (sim.step()) {
+            if (++dispatches % 4096 != 0) continue;
+            if (context.cancelled()) return outcome;
+            context.progress(set->size() ? (double)sim.getFinishedJobs().size() / set->size() : 0,
+                             "t=" + std::to_string(sim.getCurrentTime()));
+        }
+        if (!config.empty()) cache->store(hash, config, sim.getJobTable(), sim.getGanttChart());
+        outcome.report = sim.getScheduler().getStatistics();
+        return outcome;
+    });
+}
+
+void UIController::startSimulationTask() {
+    if (!scheduler) { error("No scheduler selected."); return; }
+    std::cout << "Started task " << submitSimulation() << ".\n";
+}
+
+void UIController::startComparisonTask() {
+    if (jobs.empty()) { error("No jobs to compare."); return; }
+    auto set = SharedJobSet::create(jobs);
+    ResultCache* cache = &results;
+    long long id = tasks.submit("Compare all algorithms over " + std::to_string(jobs.size()) + " jobs",
+                                [set, cache](TaskContext& context) {
+        auto configs = ComparisonRunner::defaultConfigs();
+        std::mutex mutex;
+        std::vector<ComparisonResult> sofar;
+        ComparisonOptions options;
+        options.cache = cache;
+        options.cancel = &context.cancelFlag();
+        options.onResult = [&](const ComparisonResult& result) {
+            std::lock_guard<std::mutex> lock(mutex);
+            sofar.push_back(result);
+            context.progress((double)sofar.size() / configs.size(),
+                             std::to_string(sofar.size()) + "/" + std::to_string(configs.size()) + " configs");
+            context.partial(ComparisonRunner::formatTable(sofar));
+        };
+        ThreadPool pool;
+        auto rows = ComparisonRunner::run(set, configs, pool, options);
+        return TaskOutcome{ ComparisonRunner::formatTable(rows), nullptr };
+    });
+    std::cout << "Started task " << id << ".\n";
+}
+
+void UIController::startSweepTask() {
+    SweepGrid grid;
+    SweepOptions options;
+    if (!promptSweep(grid, options)) return;
+    // Asked now: the task cannot prompt once it is done
+    std::string filename = getStringInput("CSV filename for the results (- to skip): ");
+    std::size_t total = grid.rrQuanta.size() + grid.agingThresholds.size() * grid.agingIncrements.size();
+    auto set = SharedJobSet::create(jobs);
+    long long id = tasks.submit("Parameter sweep, " + std::to_string(total) + " configs",
+                                [set, grid, options, filename, total](TaskContext& context) mutable {
+        std::mutex mutex;
+        std::size_t done = 0;
+        std::string best;
+        double bestValue = std::numeric_limits<double>::infinity();
+        options.cancel = &context.cancelFlag();
+        options.onPoint = [&](const SweepPoint& point) {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++done;
+            if (!point.pruned && !point.cancelled) {
+                double value = ParameterSweep::metricValue(point.stats, options.target);
+                if (value < bestValue) {
+                    bestValue = value;
+                    best = point.label;
+                    std::ostringstream partial;
+                    partial << std::fixed << std::setprecision(2);
+                    partial << "Best so far: " << best << ", " << ParameterSweep::metricName(options.target)
+                            << " " << bestValue;
+                    context.partial(partial.str());
+                }
+            }
+            context.progress((double)done / total, std::to_string(done) + "/" + std::to_string(total) + " configs");
+        };
+        auto points = ParameterSweep::run(set, grid, options);
+        TaskOutcome outcome;
+        outcome.report = ParameterSweep::formatRanking(points, options.target);
+        if (filename != "-" && !context.cancelled()) {
+            std::string message;
+            if (ParameterSweep::writeCsv(filename, points, options.target, message))
+                outcome.report += "Sweep results written to " + filename + "\n";
+            else
+                outcome.report += "Error: " + message + "\n";
+        }
+        return outcome;
+    });
+    std::cout << "Started task " << id << ".\n";
+}
+
+void UIController::startImportTask() {
+    std::string filename = getStringInput("CSV filename to import: ");
+    long long id = tasks.submit("Import " + filename, [this, filename](TaskContext& context) {
+        auto imported = std::make_shared<std::vector<Job>>();
+        // The loader reads to the end either way; rows after a cancel are dropped
+        CsvLoadResult result = CsvJobLoader::load(filename,
+            [&](int jobId, std::string_view name, int arrival, int burst, int priority, int deadline) {
+                if (context.cancelled()) return;
+                if (name.empty()) {
+                    imported->emplace_back(jobId, arrival, burst, priority, deadline);
+                } else {
+                    imported->emplace_back(std::string(name), arrival, burst, priority, deadline);
+                    imported->back().jobId = jobId;
+                }
+            });
+        TaskOutcome outcome;
+        if (!result.opened) throw std::runtime_error("File not found: " + filename);
+        std::ostringstream report;
+        for (const auto& rowError : result.errors)
+            report << "Line " << rowError.line << ": " << rowError.message << "\n";
+        if (result.errorCount > result.errors.size())
+            report << result.errorCount - result.errors.size() << " more rows skipped.\n";
+        report << "Jobs imported: " << result.rows << "\n";
+        outcome.report = report.str();
+        // On the menu thread, which owns the job list
+        outcome.apply = [this, imported] {
+            jobs = std::move(*imported);
+            if (scheduler) submitSimulation();
+        };
+        return outcome;
+    });
+    std::cout << "Started task " << id << "; the jobs are replaced once it finishes.\n";
 }
 
 int UIController::getIntInput(const std::string& prompt, int min, int max) {
@@ -281,7 +720,7 @@ void UIController::saveSession(const std::string& filename) {
     out << "pluginPath," << pluginPath << "\n";
     out << "jobs\n";
     for (const auto& job : jobs) {
-        out << job.serialize() << "\n"; // Assumes Job::serialize() returns CSV string
+        out << job.serialize() << "\n";
     }
     // Optionally add results/statistics here
 }
@@ -298,8 +737,7 @@ void UIController::loadSession(const std::string& filename) {
         } else if (line == "jobs") {
             while (std::getline(in, line) && !line.empty()) {
                 Job job;
-                job.deserialize(line); // Assumes Job::deserialize(const std::string&)
-                jobs.push_back(job);
+                if (job.deserialize(line)) jobs.push_back(job);
             }
         }
     }
@@ -317,5 +755,6 @@ void UIController::setTheme(const std::string& themeName) {
 
 void UIController::setUserSetting(const std::string& key, const std::string& value) {
     userSettings[key] = value;
+    if (key == "resultCacheDir") results.setDirectory(value);
     // Apply setting if needed (e.g., default algorithm, time quantum)
 }
\ No newline at end of file
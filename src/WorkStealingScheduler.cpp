@@ -0,0 +1,82 @@
+#include "../include/WorkStealingScheduler.h"
+#include "../include/Statistics.h"
+#include <sstream>
+
+WorkStealingScheduler::WorkStealingScheduler(unsigned workers)
+    : deques(workers == 0 ? 1 : workers), stolen(0) {
+    reset();
+}
+
+void WorkStealingScheduler::reset() {
+    for (auto& deque : deques) deque = std::make_unique<WorkStealingDeque<JobHandle>>();
+    stolen.store(0, std::memory_order_relaxed);
+}
+
+void WorkStealingScheduler::enqueue(JobHandle job) {
+    deques[0]->push(job);
+}
+
+JobHandle WorkStealingScheduler::dequeue() {
+    // Single-threaded use never loses a steal, so this is a plain FIFO pop
+    JobHandle job;
+    return deques[0]->steal(job) ? job : kNoJob;
+}
+
+bool WorkStealingScheduler::hasJobs() const {
+    for (const auto& deque : deques)
+        if (!deque->empty()) return true;
+    return false;
+}
+
+void WorkStealingScheduler::schedule(int currentTime) {
+    // Dispatch order is fixed by the deques
+}
+
+void WorkStealingScheduler::push(unsigned worker, JobHandle job) {
+    deques[worker]->push(job);
+}
+
+JobHandle WorkStealingScheduler::take(unsigned worker) {
+    JobHandle job;
+    if (deques[worker]->pop(job)) return job;
+    unsigned n = workerCount();
+    for (unsigned i = 1; i < n; ++i) {
+        WorkStealingDeque<JobHandle>& victim = *deques[(worker + i) % n];
+        // A lost race means someone else got that job; try the next one there
+        while (!victim.empty()) {
+            if (victim.steal(job)) {
+                stolen.fetch_add(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+    }
+    return kNoJob;
+}
+
+WorkStealingScheduler::~WorkStealingScheduler() {}
+
+void WorkStealingScheduler::attach(JobTable& jobs) {
+    Scheduler::attach(jobs);
+    reset();
+}
+
+void WorkStealingScheduler::setJobs(const std::vector<Job>& jobs) {
+    attach(ownTable);
+    attachGantt(ownGantt);
+    ownTable.clear();
+    for (const auto& job : jobs) {
+        enqueue(ownTable.add(job));
+    }
+}
+
+std::string WorkStealingScheduler::getGanttChart() const {
+    return gantt->render(*table);
+}
+
+std::string WorkStealingScheduler::getTimelineLog() const {
+    return events->format(*table);
+}
+
+std::string WorkStealingScheduler::getStatistics() const {
+    return StatisticsEngine::report(*table, "Work Stealing");
+}
\ No newline at end of file
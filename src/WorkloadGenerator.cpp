@@ -0,0 +1,80 @@
+#include "../include/WorkloadGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace {
+
+class Sampler {
+public:
+    explicit Sampler(const WorkloadSpec& spec) : spec(spec), rng(spec.seed) {
+        // Cumulative Zipf weights over the priority levels
+        int levels = std::max(1, spec.priorityLevels);
+        double total = 0;
+        for (int k = 0; k < levels; ++k) {
+            total += 1.0 / std::pow(k + 1.0, std::max(0.0, spec.prioritySkew));
+            priorityCdf.push_back(total);
+        }
+        for (double& c : priorityCdf) c /= total;
+        double shape = std::max(1.0001, spec.paretoShape);
+        paretoScale = spec.meanBurst * (shape - 1) / shape;
+    }
+
+    // Uniform in (0, 1]
+    double uniform() { return ((rng() >> 11) + 1) * 0x1.0p-53; }
+
+    double interarrival() { return -std::log(uniform()) / std::max(1e-9, spec.arrivalRate); }
+
+    int burst() {
+        double raw = spec.bursts == BurstDistribution::Pareto
+            ? paretoScale / std::pow(uniform(), 1.0 / std::max(1.0001, spec.paretoShape))
+            : -std::log(uniform()) * spec.meanBurst;
+        return (int)std::min<double>(std::max(1, spec.maxBurst), std::max(1.0, std::round(raw)));
+    }
+
+    int priority() {
+        double u = uniform();
+        auto it = std::lower_bound(priorityCdf.begin(), priorityCdf.end(), u);
+        return (int)std::min<std::ptrdiff_t>(it - priorityCdf.begin(), (std::ptrdiff_t)priorityCdf.size() - 1);
+    }
+
+private:
+    const WorkloadSpec& spec;
+    std::mt19937_64 rng;
+    std::vector<double> priorityCdf;
+    double paretoScale;
+};
+
+template <typename Sink>
+void sample(const WorkloadSpec& spec, Sink sink) {
+    Sampler sampler(spec);
+    double clock = 0;
+    for (std::size_t i = 0; i < spec.jobs; ++i) {
+        clock += sampler.interarrival();
+        int arrival = (int)std::min<double>(clock, 2e9);
+        int burst = sampler.burst();
+        int priority = sampler.priority();
+        int deadline = kNoDeadline;
+        if (spec.deadlineSlack > 0)
+            deadline = (int)std::min<double>(2e9, arrival + burst * (1 + spec.deadlineSlack));
+        sink((int)(i + 1), arrival, burst, priority, deadline);
+    }
+}
+
+}
+
+void WorkloadGenerator::generate(const WorkloadSpec& spec, JobTable& jobs) {
+    jobs.reserve(jobs.size() + spec.jobs);
+    sample(spec, [&jobs](int id, int arrival, int burst, int priority, int deadline) {
+        jobs.add(id, {}, arrival, burst, priority, deadline);
+    });
+}
+
+std::vector<Job> WorkloadGenerator::generateJobs(const WorkloadSpec& spec) {
+    std::vector<Job> jobs;
+    jobs.reserve(spec.jobs);
+    sample(spec, [&jobs](int id, int arrival, int burst, int priority, int deadline) {
+        jobs.emplace_back(id, arrival, burst, priority, deadline);
+    });
+    return jobs;
+}
\ No newline at end of file
@@ -0,0 +1,222 @@
+// ScheduleCheck.cpp
+// Randomised checks of the simulator's shortcuts against plain runs:
+// incremental re-simulation after a series of edits against a fresh run of
+// the edited set, and LLF's computed slices against a tick-by-tick
+// reference. Exits 1 on the first disagreement and prints the workload
+// Compile: g++ -std=c++17 -O2 -Iinclude tools/ScheduleCheck.cpp src/IncrementalSimulator.cpp src/Simulator.cpp src/ArrivalSource.cpp src/FCFSScheduler.cpp src/SJFScheduler.cpp src/RoundRobinScheduler.cpp src/PriorityScheduler.cpp src/EDFScheduler.cpp src/LLFScheduler.cpp src/DeadlineAdmission.cpp src/Statistics.cpp src/QuantileSketch.cpp src/GanttChart.cpp src/GanttRenderer.cpp src/OutputBuffer.cpp src/EventLog.cpp src/Instrumentation.cpp src/RunArena.cpp src/JobTable.cpp src/Job.cpp -o schedule_check
+// Run: ./schedule_check
+//      ./schedule_check --rounds 20000 --seed 7
+
+#include "../include/IncrementalSimulator.h"
+#include "../include/FCFSScheduler.h"
+#include "../include/SJFScheduler.h"
+#include "../include/RoundRobinScheduler.h"
+#include "../include/PriorityScheduler.h"
+#include "../include/EDFScheduler.h"
+#include "../include/LLFScheduler.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+using Maker = IncrementalSimulator::SchedulerMaker;
+
+struct Policy {
+    std::string name;
+    Maker make;
+};
+
+std::vector<Policy> policies() {
+    return {
+        { "FCFS", [] { return std::make_unique<FCFSScheduler>(); } },
+        { "SJF", [] { return std::make_unique<SJFScheduler>(); } },
+        { "RR q=1", [] { return std::make_unique<RoundRobinScheduler>(1); } },
+        { "RR q=3", [] { return std::make_unique<RoundRobinScheduler>(3); } },
+        { "Priority t=5 i=1", [] { return std::make_unique<PriorityScheduler>(5, 1); } },
+        { "Priority no aging", [] { return std::make_unique<PriorityScheduler>(5, 0); } },
+        { "EDF", [] { return std::make_unique<EDFScheduler>(); } },
+    };
+}
+
+// Small bursts and a busy CPU, so queues are long and edits ripple
+Job randomJob(std::mt19937_64& rng, int id, int horizon) {
+    auto pick = [&](int lo, int hi) { return std::uniform_int_distribution<int>(lo, hi)(rng); };
+    int arrival = pick(0, horizon), burst = pick(1, 8);
+    int deadline = pick(0, 3) == 0 ? kNoDeadline : arrival + burst + pick(0, 20);
+    return Job(id, arrival, burst, pick(0, 4), deadline);
+}
+
+void edit(std::mt19937_64& rng, std::vector<Job>& jobs, int& nextId, int horizon) {
+    auto pick = [&](int lo, int hi) { return std::uniform_int_distribution<int>(lo, hi)(rng); };
+    std::size_t at = (std::size_t)pick(0, (int)jobs.size() - 1);
+    switch (pick(0, 5)) {
+    case 0: jobs[at].setPriority(pick(0, 4)); break;
+    // A new Job rather than setBurstTime, which leaves remainingTime behind
+    case 1: jobs[at] = Job(jobs[at].jobId, jobs[at].arrivalTime, pick(1, 8), jobs[at].priority, jobs[at].deadline); break;
+    case 2: jobs[at].setArrivalTime(pick(0, horizon)); break;
+    case 3: jobs.insert(jobs.begin() + at, randomJob(rng, nextId++, horizon)); break;
+    case 4: if (jobs.size() > 1) jobs.erase(jobs.begin() + at); break;
+    default: jobs[at].setDeadline(jobs[at].arrivalTime + jobs[at].burstTime + pick(0, 20)); break;
+    }
+}
+
+// Per job id: start, completion, and every stretch of CPU time it got
+using Outcome = std::map<int, std::tuple<int, int, std::vector<std::pair<int, int>>>>;
+
+Outcome outcomeOf(const Simulator& sim) {
+    Outcome out;
+    const JobTable& table = sim.getJobTable();
+    for (JobHandle h = 0; h < table.size(); ++h) {
+        auto& [start, completion, runs] = out[table.id(h)];
+        start = table.start(h);
+        completion = table.completion(h);
+    }
+    for (const GanttSegment& s : sim.getGanttChart().segments())
+        std::get<2>(out[table.id(s.job)]).push_back({ s.start, s.length });
+    return out;
+}
+
+void printJobs(const std::vector<Job>& jobs) {
+    for (const auto& job : jobs)
+        std::cerr << "  {" << job.jobId << "," << job.arrivalTime << "," << job.burstTime << "," << job.priority
+                  << "," << job.deadline << "}\n";
+}
+
+void printDifference(const Outcome& got, const Outcome& want) {
+    for (const auto& [id, expected] : want) {
+        auto it = got.find(id);
+        if (it != got.end() && it->second == expected) continue;
+        std::cerr << "first difference: job " << id << " expected start " << std::get<0>(expected)
+                  << ", completion " << std::get<1>(expected);
+        if (it == got.end()) {
+            std::cerr << ", missing\n";
+            return;
+        }
+        std::cerr << ", got start " << std::get<0>(it->second) << ", completion " << std::get<1>(it->second) << "\n";
+        for (const auto* runs : { &std::get<2>(expected), &std::get<2>(it->second) }) {
+            std::cerr << (runs == &std::get<2>(expected) ? "  expected runs:" : "  got runs:");
+            for (const auto& [start, length] : *runs) std::cerr << " " << start << "+" << length;
+            std::cerr << "\n";
+        }
+        return;
+    }
+}
+
+bool checkIncremental(const Policy& policy, std::mt19937_64& rng, int edits) {
+    auto pick = [&](int lo, int hi) { return std::uniform_int_distribution<int>(lo, hi)(rng); };
+    int count = pick(5, 60), horizon = count * 3, nextId = 1;
+    long long interval = pick(1, 6);
+    std::vector<std::vector<Job>> sets(1);
+    for (int i = 0; i < count; ++i) sets[0].push_back(randomJob(rng, nextId++, horizon));
+    // Marks every few steps, so edits resume from marks the last splice remapped
+    IncrementalSimulator incremental(policy.make, interval);
+    incremental.update(sets[0]);
+    for (int e = 0; e < edits; ++e) {
+        sets.push_back(sets.back());
+        edit(rng, sets.back(), nextId, horizon);
+        Outcome got = outcomeOf(*incremental.update(sets.back()));
+        Simulator fresh(policy.make(), sets.back());
+        fresh.run();
+        Outcome want = outcomeOf(fresh);
+        if (got == want) continue;
+        std::cerr << policy.name << ", marks every " << interval << " steps: incremental run differs from a fresh one after "
+                  << e + 1 << " edits\n";
+        printDifference(got, want);
+        for (std::size_t i = 0; i < sets.size(); ++i) {
+            std::cerr << (i == 0 ? "first set:\n" : "edit " + std::to_string(i) + ":\n");
+            printJobs(sets[i]);
+        }
+        return false;
+    }
+    return true;
+}
+
+// LLF one time unit at a time: the least laxity runs, ties to the earlier
+// arrival, then the lower handle, as LLFScheduler orders them. Handles are
+// positions in arrival order, as the simulator numbers admitted jobs
+Outcome tickLLF(std::vector<Job> jobs) {
+    std::stable_sort(jobs.begin(), jobs.end(), [](const Job& a, const Job& b) { return a.arrivalTime < b.arrivalTime; });
+    std::vector<int> remaining, start(jobs.size(), -1);
+    for (const auto& job : jobs) remaining.push_back(job.burstTime);
+    Outcome out;
+    std::size_t left = jobs.size();
+    for (int t = 0; left > 0; ++t) {
+        std::size_t best = jobs.size();
+        std::int64_t bestKey = 0;
+        for (std::size_t h = 0; h < jobs.size() && jobs[h].arrivalTime <= t; ++h) {
+            if (remaining[h] == 0) continue;
+            std::int64_t key = jobs[h].hasDeadline() ? (std::int64_t)jobs[h].deadline - remaining[h]
+                                                     : std::numeric_limits<std::int64_t>::max();
+            if (best == jobs.size() || key < bestKey) {
+                best = h;
+                bestKey = key;
+            }
+        }
+        if (best == jobs.size()) continue;
+        auto& [first, completion, runs] = out[jobs[best].jobId];
+        if (start[best] < 0) start[best] = first = t;
+        if (!runs.empty() && runs.back().first + runs.back().second == t) ++runs.back().second;
+        else runs.push_back({ t, 1 });
+        if (--remaining[best] == 0) {
+            completion = t + 1;
+            --left;
+        }
+    }
+    return out;
+}
+
+bool checkLLF(std::mt19937_64& rng) {
+    auto pick = [&](int lo, int hi) { return std::uniform_int_distribution<int>(lo, hi)(rng); };
+    int count = pick(2, 12), horizon = count * 2;
+    std::vector<Job> jobs;
+    for (int i = 0; i < count; ++i) {
+        // Tight deadlines and few distinct values, so laxities tie often
+        int arrival = pick(0, horizon), burst = pick(1, 8);
+        int deadline = pick(0, 4) == 0 ? kNoDeadline : arrival + burst + pick(-2, 10);
+        jobs.push_back(Job(i + 1, arrival, burst, 0, deadline));
+    }
+    Simulator sim(std::make_unique<LLFScheduler>(), jobs);
+    sim.run();
+    Outcome got = outcomeOf(sim), want = tickLLF(jobs);
+    if (got == want) return true;
+    std::cerr << "LLF: run differs from the tick-by-tick reference\n";
+    printDifference(got, want);
+    printJobs(jobs);
+    return false;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    long long rounds = 3000;
+    std::uint64_t seed = 1;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--rounds" && i + 1 < argc) rounds = std::stoll(argv[++i]);
+        else if (arg == "--seed" && i + 1 < argc) seed = std::stoull(argv[++i]);
+        else {
+            std::cerr << "Usage: schedule_check [--rounds N] [--seed S]\n";
+            return 2;
+        }
+    }
+
+    std::mt19937_64 rng(seed);
+    for (const Policy& policy : policies()) {
+        for (long long r = 0; r < rounds; ++r) {
+            if (!checkIncremental(policy, rng, 6)) return 1;
+        }
+        std::cout << policy.name << ": incremental OK (" << rounds << " workloads, 6 edits each)\n";
+    }
+    for (long long r = 0; r < rounds; ++r) {
+        if (!checkLLF(rng)) return 1;
+    }
+    std::cout << "LLF: matches the tick reference (" << rounds << " workloads)\n";
+    return 0;
+}
\ No newline at end of file
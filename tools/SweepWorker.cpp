@@ -0,0 +1,40 @@
+// SweepWorker.cpp
+// Headless worker for sweep_coordinator: runs the tasks it is sent on every
+// hardware thread and sends back each run's metric sketches
+// Compile: g++ -std=c++17 -O2 -pthread -Iinclude tools/SweepWorker.cpp src/DistributedSweep.cpp src/ComparisonRunner.cpp src/ResultCache.cpp src/ThreadPool.cpp src/Simulator.cpp src/ArrivalSource.cpp src/FCFSScheduler.cpp src/SJFScheduler.cpp src/RoundRobinScheduler.cpp src/PriorityScheduler.cpp src/MLFQScheduler.cpp src/CFSScheduler.cpp src/EDFScheduler.cpp src/LLFScheduler.cpp src/DeadlineAdmission.cpp src/TraceFile.cpp src/CsvLoader.cpp src/Statistics.cpp src/QuantileSketch.cpp src/GanttChart.cpp src/GanttRenderer.cpp src/OutputBuffer.cpp src/EventLog.cpp src/RunArena.cpp src/JobTable.cpp src/Job.cpp -o sweep_worker
+// Run: ./sweep_worker coordinator-host 7070
+//      ./sweep_worker --threads 8 --quiet coordinator-host
+
+#include "../include/DistributedSweep.h"
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    unsigned threads = 0;
+    bool quiet = false;
+    std::string host;
+    std::uint16_t port = CoordinatorOptions().port;
+    bool usage = false;
+    int positional = 0;
+    for (int i = 1; i < argc && !usage; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc) threads = (unsigned)std::stoul(argv[++i]);
+        else if (arg == "--quiet") quiet = true;
+        else if (arg[0] != '-' && positional == 0) { host = arg; ++positional; }
+        else if (arg[0] != '-' && positional == 1) { port = (std::uint16_t)std::stoi(arg); ++positional; }
+        else usage = true;
+    }
+    if (usage || host.empty()) {
+        std::cerr << "Usage: " << argv[0] << " [--threads N] [--quiet] coordinator-host [port]\n";
+        return 2;
+    }
+    std::string error;
+    auto log = [quiet](const std::string& line) {
+        if (!quiet) std::cerr << line << std::endl;
+    };
+    if (!DistributedSweep::work(host, port, threads, error, log)) {
+        std::cerr << "Error: " << error << std::endl;
+        return 1;
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+// TraceConvert.cpp
+// Converts job sets between CSV and the binary trace format
+// Compile: g++ -std=c++17 -O2 -Iinclude tools/TraceConvert.cpp src/TraceFile.cpp src/CsvLoader.cpp src/GanttChart.cpp src/GanttRenderer.cpp src/OutputBuffer.cpp src/JobTable.cpp src/Job.cpp -o trace_convert
+// Run: ./trace_convert jobs.csv jobs.jtr   (or the reverse)
+//      ./trace_convert --info jobs.jtr
+
+#include "../include/TraceFile.h"
+#include <iostream>
+#include <string>
+
+static bool endsWith(const std::string& s, const std::string& suffix) {
+    return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc == 3 && std::string(argv[1]) == "--info") {
+        MappedTrace trace;
+        std::string error;
+        if (!trace.open(argv[2], error)) {
+            std::cerr << "Error: " << error << std::endl;
+            return 1;
+        }
+        std::cout << "Kind: " << (trace.kind() == TraceKind::Schedule ? "schedule" : "jobs") << "\n";
+        std::cout << "Version: " << TraceFile::kVersion << "\n";
+        std::cout << "Jobs: " << trace.jobCount() << "\n";
+        std::cout << "Gantt segments: " << trace.segmentCount() << "\n";
+        return 0;
+    }
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <input.csv> <output.jtr>\n"
+                  << "       " << argv[0] << " <input.jtr> <output.csv>\n"
+                  << "       " << argv[0] << " --info <trace.jtr>\n";
+        return 2;
+    }
+
+    std::string input = argv[1], output = argv[2], error;
+    if (endsWith(input, ".csv")) {
+        CsvLoadResult rows;
+        bool ok = TraceFile::csvToTrace(input, output, error, &rows);
+        for (const auto& rowError : rows.errors)
+            std::cerr << input << ":" << rowError.line << ": " << rowError.message << "\n";
+        if (rows.errorCount > rows.errors.size())
+            std::cerr << (rows.errorCount - rows.errors.size()) << " more rows skipped\n";
+        if (!ok) {
+            std::cerr << "Error: " << error << std::endl;
+            return 1;
+        }
+        std::cout << "Wrote " << rows.rows << " jobs to " << output << "\n";
+    } else {
+        if (!TraceFile::traceToCsv(input, output, error)) {
+            std::cerr << "Error: " << error << std::endl;
+            return 1;
+        }
+        std::cout << "Wrote " << output << "\n";
+    }
+    return 0;
+}
\ No newline at end of file